@@ -34,6 +34,8 @@
 
 #include "../almost_satisfies_types.h"
 #include "../boolean_testable.h"
+#include "../counting_predicates.h"
+#include "../counting_projection.h"
 #include "../test_iterators.h"
 #include "rxx/algorithm/contains.h"
 #include "rxx/ranges.h"
@@ -345,6 +347,44 @@ constexpr void test_iterators() {
     }
 }
 
+// Upper bounds on the work done by contains_subrange: the naive search never
+// compares more than (N - M + 1) * M pairs, and an empty needle compares none.
+template <class Iter1, class Sent1, class Iter2, class Sent2>
+constexpr void test_complexity() {
+    int a[] = {1, 1, 1, 1, 2, 1, 1, 1, 2};
+    constexpr int n = 9;
+
+    { // matching the needle at the very end
+        int p[] = {1, 1, 2};
+        constexpr int m = 3;
+        int predicate_count = 0;
+        int projection1_count = 0;
+        int projection2_count = 0;
+        auto whole = xranges::subrange(Iter1(a), Sent1(Iter1(a + n)));
+        auto needle = xranges::subrange(Iter2(p), Sent2(Iter2(p + m)));
+        assert(xranges::contains_subrange(whole, needle,
+            counting_predicate(xranges::equal_to(), predicate_count),
+            counting_projection(projection1_count),
+            counting_projection(projection2_count)));
+        assert(predicate_count <= (n - m + 1) * m);
+        assert(projection1_count <= (n - m + 1) * m);
+        assert(projection2_count <= (n - m + 1) * m);
+    }
+
+    { // an empty needle is contained without comparing anything
+        IteratorOpCounts ops;
+        int predicate_count = 0;
+        using It = operation_counting_iterator<Iter1>;
+        auto whole = xranges::subrange(
+            It(Iter1(a), &ops), sentinel_wrapper<It>(It(Iter1(a + n))));
+        auto needle = xranges::subrange(Iter2(a), Sent2(Iter2(a)));
+        assert(xranges::contains_subrange(whole, needle,
+            counting_predicate(xranges::equal_to(), predicate_count)));
+        assert(predicate_count == 0);
+        assert(ops.increments == 0);
+    }
+}
+
 constexpr bool test() {
     types::for_each(types::forward_iterator_list<int*>{}, []<class Iter1> {
         types::for_each(types::forward_iterator_list<int*>{}, []<class Iter2> {
@@ -356,6 +396,14 @@ constexpr bool test() {
         });
     });
 
+    test_complexity<forward_iterator<int*>, forward_iterator<int*>,
+        forward_iterator<int*>, forward_iterator<int*>>();
+    test_complexity<int*, int*, int*, int*>();
+    test_complexity<random_access_iterator<int*>,
+        sized_sentinel<random_access_iterator<int*>>,
+        random_access_iterator<int*>,
+        sized_sentinel<random_access_iterator<int*>>>();
+
     assert(xranges::contains_subrange(xviews::iota(0, 5),
         xviews::iota(0, 5) | xviews::filter([](int) { return true; })));
     assert(!xranges::contains_subrange(
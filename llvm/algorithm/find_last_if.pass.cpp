@@ -24,6 +24,9 @@
 
 #include "../almost_satisfies_types.h"
 #include "../boolean_testable.h"
+#include "../copy_counting.h"
+#include "../counting_predicates.h"
+#include "../counting_projection.h"
 #include "../test_iterators.h"
 #include "rxx/algorithm/find_last.h"
 #include "rxx/ranges.h"
@@ -236,6 +239,63 @@ struct add_const_to_ptr<T*> {
 template <class T>
 using add_const_to_ptr_t = typename add_const_to_ptr<T>::type;
 
+// Upper bounds on the work done by find_last_if, so that a regression such as
+// evaluating the predicate twice per element fails the suite.
+template <class It>
+constexpr void test_complexity() {
+    int a[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    constexpr std::size_t n = 8;
+
+    { // each element is inspected once when nothing matches; the iterator
+      // may be advanced to `last` first and walked back
+        IteratorOpCounts ops;
+        int predicate_count = 0;
+        int projection_count = 0;
+        using counting_it = operation_counting_iterator<It>;
+        auto ret = xranges::find_last_if(counting_it(It(a), &ops),
+            sentinel_wrapper<counting_it>(counting_it(It(a + n))),
+            counting_predicate([](int) { return false; }, predicate_count),
+            counting_projection(projection_count));
+        assert(base(base(ret.begin())) == a + n);
+        assert(predicate_count == static_cast<int>(n));
+        assert(projection_count == static_cast<int>(n));
+        assert(ops.increments + ops.decrements <= 2 * n);
+    }
+
+    { // a bidirectional common range stops at the last match
+        IteratorOpCounts ops;
+        int predicate_count = 0;
+        using counting_it = operation_counting_iterator<It>;
+        auto ret = xranges::find_last_if(counting_it(It(a), &ops),
+            counting_it(It(a + n), &ops),
+            counting_predicate([](int i) { return i == 6; }, predicate_count));
+        assert(*ret.begin() == 6);
+        if constexpr (std::bidirectional_iterator<It>) {
+            assert(predicate_count <= 3);
+            assert(ops.increments + ops.decrements <= n);
+        } else {
+            assert(predicate_count == static_cast<int>(n));
+            assert(ops.increments <= n);
+        }
+    }
+
+    { // elements are inspected in place, never copied
+        element_copy_counts counts;
+        copy_counting<int> elements[] = {
+            {1, counts},
+            {2, counts},
+            {1, counts},
+            {3, counts}
+        };
+        counts = {};
+        auto ret = xranges::find_last_if(elements,
+            [](copy_counting<int> const& e) { return e.value() == 1; });
+        assert(ret.begin() == elements + 2);
+        assert(counts.copies == 0);
+        assert(counts.moves == 0);
+    }
+}
+
 constexpr bool test() {
     test_iterator_classes<std::type_identity_t, std::type_identity_t>();
     test_iterator_classes<add_const_to_ptr_t, std::type_identity_t>();
@@ -245,6 +305,10 @@ constexpr bool test() {
     test_iterator_classes<forward_iterator, std::type_identity_t>();
     test_iterator_classes<forward_iterator, sentinel_wrapper>();
 
+    test_complexity<forward_iterator<int*>>();
+    test_complexity<bidirectional_iterator<int*>>();
+    test_complexity<random_access_iterator<int*>>();
+
     {
         // check that projections are used properly and that they are called
         // with the iterator directly
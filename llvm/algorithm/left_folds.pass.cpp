@@ -33,9 +33,11 @@
 // iterator_t<R>> F>
 //   constexpr see below ranges::fold_left(R&& r, T init, F f);
 
+#include "../copy_counting.h"
 #include "../invocable_with_telemetry.h"
 #include "../maths.h"
 #include "../static_asserts.h"
+#include "../test_iterators.h"
 #include "../test_range.h"
 #include "rxx/algorithm.h"
 #include "rxx/ranges.h"
@@ -282,10 +284,54 @@ constexpr void non_common_range_test_case() {
     }
 }
 
+// Upper bounds on the work done by a left fold: one pass over the range, one
+// invocation per element and no copies of either the elements or the
+// accumulator.
+constexpr void complexity_test_case() {
+    {
+        int data[] = {1, 2, 3, 4, 5, 6, 7};
+        constexpr std::size_t n = 7;
+        using It = operation_counting_iterator<forward_iterator<int*>>;
+        IteratorOpCounts ops;
+        auto telemetry = invocable_telemetry();
+        auto f = invocable_with_telemetry(std::plus(), telemetry);
+        auto result = fold_left_with_iter(It(forward_iterator(data), &ops),
+            sentinel_wrapper<It>(It(forward_iterator(data + n))), 0, f);
+        assert(result.value == 28);
+        assert(telemetry.invocations == static_cast<int>(n));
+        assert(ops.increments == n);
+        assert(ops.equal_cmps <= n + 1);
+    }
+
+    {
+        element_copy_counts element_counts;
+        element_copy_counts accumulator_counts;
+        copy_counting<int> data[] = {
+            {1, element_counts},
+            {2, element_counts},
+            {3, element_counts},
+            {4, element_counts}
+        };
+        element_counts = {};
+        auto f = [&](copy_counting<int> accumulator,
+                     copy_counting<int> const& element) {
+            return copy_counting<int>(
+                accumulator.value() + element.value(), accumulator_counts);
+        };
+        auto result =
+            fold_left(data, copy_counting<int>(0, accumulator_counts), f);
+        assert(result.value() == 10);
+        assert(element_counts.copies == 0);
+        assert(element_counts.moves == 0);
+        assert(accumulator_counts.copies == 0);
+    }
+}
+
 constexpr bool test_case() {
     empty_range_test_case();
     common_range_test_case();
     non_common_range_test_case();
+    complexity_test_case();
     return true;
 }
 
@@ -0,0 +1,60 @@
+// Copyright 2025 Bryan Wong
+
+#ifndef TEST_SUPPORT_COPY_COUNTING_H
+#define TEST_SUPPORT_COPY_COUNTING_H
+
+#include <utility>
+
+// Element type that records every copy and move of itself, used to check
+// that algorithms and views do not copy elements they only need to inspect.
+struct element_copy_counts {
+    int copies = 0;
+    int moves = 0;
+};
+
+template <class T>
+class copy_counting {
+public:
+    constexpr copy_counting(T value, element_copy_counts& counts)
+        : value_(std::move(value))
+        , counts_(&counts) {}
+
+    constexpr copy_counting(copy_counting const& other)
+        : value_(other.value_)
+        , counts_(other.counts_) {
+        ++counts_->copies;
+    }
+
+    constexpr copy_counting(copy_counting&& other)
+        : value_(std::move(other.value_))
+        , counts_(other.counts_) {
+        ++counts_->moves;
+    }
+
+    constexpr copy_counting& operator=(copy_counting const& other) {
+        value_ = other.value_;
+        counts_ = other.counts_;
+        ++counts_->copies;
+        return *this;
+    }
+
+    constexpr copy_counting& operator=(copy_counting&& other) {
+        value_ = std::move(other.value_);
+        counts_ = other.counts_;
+        ++counts_->moves;
+        return *this;
+    }
+
+    constexpr T const& value() const { return value_; }
+
+    friend constexpr bool operator==(
+        copy_counting const& left, copy_counting const& right) {
+        return left.value_ == right.value_;
+    }
+
+private:
+    T value_;
+    element_copy_counts* counts_;
+};
+
+#endif // TEST_SUPPORT_COPY_COUNTING_H
@@ -0,0 +1,47 @@
+// Copyright 2025 Bryan Wong
+// Adapted from LLVM testsuite
+
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef TEST_SUPPORT_COUNTING_PREDICATES_H
+#define TEST_SUPPORT_COUNTING_PREDICATES_H
+
+#include <functional>
+#include <utility>
+
+// Counts every invocation in an external counter so that copies made by the
+// algorithm or view under test share the same count.
+template <class Predicate>
+class counting_predicate {
+    Predicate pred_;
+    int* count_ = nullptr;
+
+public:
+    constexpr counting_predicate() = default;
+    constexpr counting_predicate(Predicate pred, int& count)
+        : pred_(std::move(pred))
+        , count_(&count) {}
+
+    template <class... Args>
+    constexpr decltype(auto) operator()(Args&&... args) {
+        ++(*count_);
+        return std::invoke(pred_, std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    constexpr decltype(auto) operator()(Args&&... args) const {
+        ++(*count_);
+        return std::invoke(pred_, std::forward<Args>(args)...);
+    }
+};
+
+template <class Predicate>
+counting_predicate(Predicate pred, int& count) -> counting_predicate<Predicate>;
+
+#endif // TEST_SUPPORT_COUNTING_PREDICATES_H
@@ -0,0 +1,106 @@
+// Copyright 2025 Bryan Wong
+
+// <ranges>
+
+// Upper bounds on the predicate calls, iterator increments and element copies
+// made by chunk_by_view. Extra work in `begin()` or comparing an adjacent pair
+// more than once fails these tests.
+
+#include "../../copy_counting.h"
+#include "../../counting_predicates.h"
+#include "../../test_iterators.h"
+#include "rxx/ranges/chunk_by_view.h"
+#include "rxx/ranges/subrange.h"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+
+template <class It>
+constexpr auto counted_range(int* first, int* last, IteratorOpCounts& ops) {
+    using counting_it = operation_counting_iterator<It>;
+    return xranges::subrange(
+        counting_it(It(first), &ops), counting_it(It(last), &ops));
+}
+
+template <class It>
+constexpr void test_chunk_by() {
+    int a[] = {1, 1, 2, 2, 2, 3, 4, 4, 5, 5};
+    constexpr std::size_t n = 10;
+
+    { // a full pass compares each adjacent pair at most once
+        IteratorOpCounts ops;
+        int predicate_count = 0;
+        auto view = xviews::chunk_by(counted_range<It>(a, a + n, ops),
+            counting_predicate(std::equal_to<>(), predicate_count));
+        int chunks = 0;
+        for (auto chunk : view) {
+            assert(!chunk.empty());
+            ++chunks;
+        }
+        assert(chunks == 5);
+        assert(predicate_count <= static_cast<int>(n - 1));
+        assert(ops.increments <= 2 * n);
+    }
+
+    { // begin() is cached after the first call
+        IteratorOpCounts ops;
+        int predicate_count = 0;
+        auto view = xviews::chunk_by(counted_range<It>(a, a + n, ops),
+            counting_predicate(std::equal_to<>(), predicate_count));
+        assert(xranges::distance(*view.begin()) == 2);
+        int const first_count = predicate_count;
+        assert(first_count <= 2);
+        for (int i = 0; i < 3; ++i)
+            assert(xranges::distance(*view.begin()) == 2);
+        assert(predicate_count == first_count);
+    }
+
+    if constexpr (std::bidirectional_iterator<It>) {
+        // walking back compares each adjacent pair at most once
+        IteratorOpCounts ops;
+        int predicate_count = 0;
+        auto view = xviews::chunk_by(counted_range<It>(a, a + n, ops),
+            counting_predicate(std::equal_to<>(), predicate_count));
+        int chunks = 0;
+        for (auto it = view.end(); it != view.begin(); --it)
+            ++chunks;
+        assert(chunks == 5);
+        // begin() compares the first chunk, the walk back every pair.
+        assert(predicate_count <= static_cast<int>(n - 1 + 2));
+    }
+
+    { // elements are inspected in place, never copied
+        element_copy_counts counts;
+        copy_counting<int> elements[] = {
+            {1, counts},
+            {1, counts},
+            {2, counts},
+            {3, counts}
+        };
+        counts = {};
+        int chunks = 0;
+        for ([[maybe_unused]] auto chunk :
+            elements | xviews::chunk_by(std::equal_to<>()))
+            ++chunks;
+        assert(chunks == 3);
+        assert(counts.copies == 0);
+        assert(counts.moves == 0);
+    }
+}
+
+constexpr bool test() {
+    test_chunk_by<forward_iterator<int*>>();
+    test_chunk_by<bidirectional_iterator<int*>>();
+    test_chunk_by<random_access_iterator<int*>>();
+    return true;
+}
+
+int main(int, char**) {
+    test();
+    static_assert(test());
+    return 0;
+}
@@ -0,0 +1,114 @@
+// Copyright 2025 Bryan Wong
+
+// <ranges>
+
+// Upper bounds on the predicate calls, iterator increments and element copies
+// made by filter_view. Extra work in `begin()` or re-evaluating the predicate
+// of an element already visited fails these tests.
+
+#include "../../copy_counting.h"
+#include "../../counting_predicates.h"
+#include "../../test_iterators.h"
+#include "rxx/ranges/filter_view.h"
+#include "rxx/ranges/subrange.h"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+
+template <class It>
+constexpr auto counted_range(int* first, int* last, IteratorOpCounts& ops) {
+    using counting_it = operation_counting_iterator<It>;
+    return xranges::subrange(
+        counting_it(It(first), &ops), counting_it(It(last), &ops));
+}
+
+template <class It>
+constexpr void test_filter() {
+    int a[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    constexpr std::size_t n = 10;
+    auto is_even = [](int i) { return i % 2 == 0; };
+
+    { // a full pass evaluates the predicate once per element
+        IteratorOpCounts ops;
+        int predicate_count = 0;
+        auto view = xviews::filter(counted_range<It>(a, a + n, ops),
+            counting_predicate(is_even, predicate_count));
+        int total = 0;
+        for (int i : view)
+            total += i;
+        assert(total == 30);
+        assert(predicate_count == static_cast<int>(n));
+        assert(ops.increments == n);
+    }
+
+    { // begin() is cached after the first call
+        IteratorOpCounts ops;
+        int predicate_count = 0;
+        auto view = xviews::filter(counted_range<It>(a, a + n, ops),
+            counting_predicate([](int i) { return i > 8; }, predicate_count));
+        assert(*view.begin() == 9);
+        int const first_count = predicate_count;
+        std::size_t const first_increments = ops.increments;
+        assert(first_count == 9);
+        assert(first_increments <= 8);
+        for (int i = 0; i < 3; ++i)
+            assert(*view.begin() == 9);
+        assert(predicate_count == first_count);
+        // A random access begin() may be cached as an offset instead.
+        if constexpr (!std::random_access_iterator<It>)
+            assert(ops.increments == first_increments);
+    }
+
+    if constexpr (std::bidirectional_iterator<It>) {
+        // walking back evaluates each element passed once
+        IteratorOpCounts ops;
+        int predicate_count = 0;
+        auto view = xviews::filter(counted_range<It>(a, a + n, ops),
+            counting_predicate(is_even, predicate_count));
+        auto it = view.end();
+        int total = 0;
+        while (it != view.begin())
+            total += *--it;
+        assert(total == 30);
+        // begin() scans to the first match, the walk back every element.
+        assert(predicate_count <= static_cast<int>(n + 2));
+        assert(ops.decrements <= n);
+    }
+
+    { // elements are inspected in place, never copied
+        element_copy_counts counts;
+        copy_counting<int> elements[] = {
+            {1, counts},
+            {2, counts},
+            {3, counts},
+            {4, counts}
+        };
+        counts = {};
+        int total = 0;
+        for (auto const& e :
+            elements | xviews::filter([](copy_counting<int> const& e) {
+                return e.value() % 2 == 0;
+            }))
+            total += e.value();
+        assert(total == 6);
+        assert(counts.copies == 0);
+        assert(counts.moves == 0);
+    }
+}
+
+constexpr bool test() {
+    test_filter<forward_iterator<int*>>();
+    test_filter<bidirectional_iterator<int*>>();
+    test_filter<random_access_iterator<int*>>();
+    return true;
+}
+
+int main(int, char**) {
+    test();
+    static_assert(test());
+    return 0;
+}
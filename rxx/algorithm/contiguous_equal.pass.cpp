@@ -0,0 +1,202 @@
+// Copyright 2025 Bryan Wong
+
+// equal, starts_with and ends_with over contiguous, sized ranges of trivially
+// equality comparable types may compare bytes with memcmp. These tests cover
+// every length and mismatch position around the vector widths, and the types
+// and calls that must keep comparing element by element: floating point,
+// mixed element types, custom predicates and projections, and constant
+// evaluation.
+
+#include "rxx/algorithm/ends_with.h"
+#include "rxx/algorithm/equal.h"
+#include "rxx/algorithm/starts_with.h"
+
+#include "generic_path.h"
+#include "rxx/ranges.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+
+constexpr std::size_t max_length = 80;
+
+template <class T>
+void test_lengths(T value, T other) {
+    std::array<T, max_length + 1> left;
+    std::array<T, max_length + 1> right;
+    left.fill(value);
+    right.fill(value);
+    for (std::size_t length = 0; length <= max_length; ++length) {
+        // Unaligned views of both buffers.
+        std::span<T> a(left.data() + 1, length);
+        std::span<T> b(right.data() + (length & 1), length);
+        assert(xranges::equal(a, b));
+        assert(xranges::equal(a.begin(), a.end(), b.begin(), b.end()));
+        assert(xranges::starts_with(a, b));
+        assert(xranges::ends_with(a, b));
+
+        for (std::size_t pos = 0; pos != length; ++pos) {
+            b[pos] = other;
+            assert(!xranges::equal(a, b));
+            assert(!xranges::equal(a.begin(), a.end(), b.begin(), b.end()));
+            assert(!xranges::starts_with(a, b));
+            assert(!xranges::ends_with(a, b));
+            // Only the prefix before, or the suffix after, the mismatch
+            // still matches.
+            assert(xranges::starts_with(a, b.first(pos)));
+            assert(!xranges::starts_with(a, b.first(pos + 1)));
+            assert(xranges::ends_with(a, b.last(length - pos - 1)));
+            assert(!xranges::ends_with(a, b.last(length - pos)));
+            b[pos] = value;
+        }
+
+        if (length != 0) {
+            assert(!xranges::equal(a, b.first(length - 1)));
+            assert(xranges::starts_with(a, b.first(length - 1)));
+            assert(xranges::ends_with(a, b.last(length - 1)));
+            assert(!xranges::starts_with(a.first(length - 1), b));
+            assert(!xranges::ends_with(a.last(length - 1), b));
+        }
+    }
+}
+
+template <class T>
+void test_type() {
+    using limits = std::numeric_limits<T>;
+    test_lengths<T>(T(0), T(1));
+    test_lengths<T>(limits::max(), limits::min());
+    if constexpr (limits::is_signed)
+        test_lengths<T>(T(-1), T(1));
+}
+
+enum class color : std::uint8_t { red, green, blue };
+
+void test_scalars() {
+    test_type<char>();
+    test_type<signed char>();
+    test_type<unsigned char>();
+    test_type<char8_t>();
+    test_type<std::int16_t>();
+    test_type<std::uint32_t>();
+    test_type<std::int64_t>();
+    test_lengths<color>(color::red, color::blue);
+    test_lengths<bool>(false, true);
+
+    int values[3] = {};
+    test_lengths<int*>(values, values + 2);
+    test_lengths<int const*>(nullptr, values);
+}
+
+// -0.0 == 0.0 and NaN != NaN although their bytes say otherwise.
+void test_floating_point() {
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> zeros(max_length, 0.0);
+    std::vector<double> negative_zeros(max_length, -0.0);
+    assert(xranges::equal(zeros, negative_zeros));
+    assert(xranges::starts_with(zeros, std::span(negative_zeros).first(9)));
+    assert(xranges::ends_with(zeros, std::span(negative_zeros).last(33)));
+
+    std::vector<double> nans(max_length, nan);
+    assert(!xranges::equal(nans, nans));
+    assert(!xranges::starts_with(nans, std::span(nans).first(1)));
+    assert(!xranges::ends_with(nans, std::span(nans).last(1)));
+    assert(xranges::starts_with(nans, std::span(nans).first(0)));
+
+    std::vector<float> float_zeros(17, 0.0f);
+    std::vector<float> float_negative_zeros(17, -0.0f);
+    assert(xranges::equal(float_zeros, float_negative_zeros));
+}
+
+// Padding bytes are not part of the value.
+struct padded {
+    char c;
+    int i;
+    friend constexpr bool operator==(padded const&, padded const&) = default;
+};
+
+void test_not_trivially_comparable() {
+    std::vector<padded> a(20), b(20);
+    std::memset(a.data(), 0x00, a.size() * sizeof(padded));
+    std::memset(b.data(), 0xff, b.size() * sizeof(padded));
+    for (std::size_t i = 0; i != a.size(); ++i) {
+        a[i].c = b[i].c = 'x';
+        a[i].i = b[i].i = static_cast<int>(i);
+    }
+    assert(xranges::equal(a, b));
+    assert(xranges::starts_with(a, std::span(b).first(7)));
+    assert(xranges::ends_with(a, std::span(b).last(7)));
+
+    // Mixed element types compare values, not bytes.
+    std::vector<int> ints = {1, -2, 3, -4};
+    std::vector<long long> longs = {1, -2, 3, -4};
+    std::vector<long long> positives = {1, 2, 3, 4};
+    assert(xranges::equal(ints, longs));
+    assert(xranges::starts_with(longs, std::span(ints).first(2)));
+    assert(!xranges::equal(ints, positives));
+}
+
+void test_predicates_and_projections() {
+    std::string_view const message = "GET /index.html HTTP/1.1";
+    assert(xranges::starts_with(message, std::string_view("GET ")));
+    assert(!xranges::starts_with(message, std::string_view("get ")));
+    assert(xranges::starts_with(
+        message, std::string_view("get "), {}, [](char c) { return c | 0x20; },
+        [](char c) { return c | 0x20; }));
+    assert(xranges::ends_with(message, std::string_view("HTTP/1.1")));
+    assert(xranges::ends_with(message, std::string_view("1.1"), {}, generic));
+
+    std::vector<std::uint32_t> words = {1, 2, 3, 4};
+    std::vector<std::uint32_t> halves = {0, 1, 1, 2};
+    assert(!xranges::equal(words, halves));
+    assert(xranges::equal(
+        words, halves, {}, [](std::uint32_t w) { return w / 2; }));
+    assert(xranges::equal(words, halves,
+        [](std::uint32_t a, std::uint32_t b) { return a / 2 == b; }));
+
+    // Sized but not contiguous ranges keep working.
+    std::deque<char> deque(message.begin(), message.end());
+    assert(xranges::starts_with(deque, std::string_view("GET")));
+    assert(xranges::ends_with(deque, std::string_view("1.1")));
+    assert(xranges::equal(deque, message));
+}
+
+constexpr bool test_constexpr() {
+    using namespace std::string_view_literals;
+    std::string_view const frame = "\x08\x96\x01payload\x00\xff"sv;
+    assert(xranges::starts_with(frame, std::string_view("\x08\x96")));
+    assert(!xranges::starts_with(frame, std::string_view("\x08\x97")));
+    assert(xranges::ends_with(frame, std::string_view("\x00\xff", 2)));
+    assert(xranges::equal(frame, frame));
+
+    std::uint32_t const a[] = {1, 2, 3, 4};
+    std::uint32_t const b[] = {1, 2, 3, 5};
+    assert(!xranges::equal(a, b));
+    assert(xranges::starts_with(a, std::span(b).first(3)));
+    assert(!xranges::ends_with(a, std::span(b).last(1)));
+
+    double const zero[] = {0.0};
+    double const negative_zero[] = {-0.0};
+    assert(xranges::equal(zero, negative_zero));
+    return true;
+}
+
+int main(int, char**) {
+    test_scalars();
+    test_floating_point();
+    test_not_trivially_comparable();
+    test_predicates_and_projections();
+
+    test_constexpr();
+    static_assert(test_constexpr());
+
+    return 0;
+}
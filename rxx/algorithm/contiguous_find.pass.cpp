@@ -0,0 +1,148 @@
+// Copyright 2025 Bryan Wong
+
+// contains and find_last over contiguous ranges of integers and characters
+// with the default projection may be vectorised. These tests cover every
+// length and match position around the vector widths, unaligned starts and
+// values that do not fit the element type, and check the results against the
+// generic path taken when a projection is given.
+
+#include "rxx/algorithm/contains.h"
+#include "rxx/algorithm/find_last.h"
+
+#include "generic_path.h"
+#include "rxx/ranges.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+
+// Spans two 256-bit vectors of bytes plus a partial tail.
+constexpr std::size_t max_length = 80;
+constexpr std::size_t max_offset = 32;
+
+template <class T>
+void test_lengths(T filler, T needle) {
+    std::vector<T> storage(max_offset + max_length, filler);
+    for (std::size_t offset = 0; offset != max_offset; ++offset) {
+        for (std::size_t length = 0; length <= max_length; ++length) {
+            std::span<T> range(storage.data() + offset, length);
+            assert(!xranges::contains(range, needle));
+            assert(xranges::find_last(range, needle).begin() == range.end());
+
+            for (std::size_t pos = 0; pos != length; ++pos) {
+                range[pos] = needle;
+                assert(xranges::contains(range, needle));
+                assert(xranges::contains(range.begin(), range.end(), needle));
+                auto last = xranges::find_last(range, needle);
+                assert(last.begin() == range.begin() + pos);
+                assert(last.end() == range.end());
+
+                // A second match further right is the one found last.
+                if (pos + 1 < length) {
+                    range[length - 1] = needle;
+                    assert(xranges::find_last(range, needle).begin() ==
+                        range.end() - 1);
+                    range[length - 1] = filler;
+                }
+                range[pos] = filler;
+            }
+        }
+    }
+}
+
+template <class T>
+void test_type() {
+    using limits = std::numeric_limits<T>;
+    test_lengths<T>(T(0), T(1));
+    test_lengths<T>(T(1), T(0));
+    test_lengths<T>(limits::min(), limits::max());
+    test_lengths<T>(limits::max(), limits::min());
+    if constexpr (limits::is_signed)
+        test_lengths<T>(T(1), T(-1));
+}
+
+// A value of a wider type must not be narrowed to the element type before
+// comparing: 0x141 is not equal to any char, even though (char)0x141 is 'A'.
+void test_wider_value() {
+    std::vector<char> chars(max_length, 'A');
+    assert(!xranges::contains(chars, 0x141));
+    assert(xranges::find_last(chars, 0x141).begin() == chars.end());
+    assert(xranges::contains(chars, 0x41));
+
+    std::vector<std::uint8_t> bytes(max_length, 0xff);
+    assert(!xranges::contains(bytes, -1));
+    assert(xranges::contains(bytes, 255));
+    assert(xranges::find_last(bytes, -1).begin() == bytes.end());
+
+    std::vector<std::uint32_t> words(max_length, 0xffffffffu);
+    assert(!xranges::contains(words, -1LL));
+    assert(xranges::contains(words, 0xffffffffLL));
+    assert(!xranges::contains(words, std::int64_t(0x1ffffffffLL)));
+}
+
+void test_agrees_with_generic() {
+    std::vector<std::uint32_t> words;
+    for (std::uint32_t i = 0; i != 1000; ++i)
+        words.push_back((i * 2654435761u) % 97);
+    for (std::uint32_t value = 0; value != 100; ++value) {
+        assert(xranges::contains(words, value) ==
+            xranges::contains(words, value, generic));
+        assert(xranges::find_last(words, value).begin() ==
+            xranges::find_last(words, value, generic).begin());
+    }
+
+    std::string_view const log = "2025-01-01 INFO started\n"
+                                 "2025-01-01 WARN disk almost full\n"
+                                 "2025-01-01 INFO stopped\n";
+    std::span<char const> bytes(log.data(), log.size());
+    for (char c : {'\n', 'W', 'x', '\0', 'I'}) {
+        assert(xranges::contains(bytes, c) ==
+            xranges::contains(bytes, c, generic));
+        assert(xranges::find_last(bytes, c).begin() ==
+            xranges::find_last(bytes, c, generic).begin());
+    }
+    assert(xranges::find_last(bytes, 'W').begin() ==
+        bytes.begin() + log.find('W'));
+    assert(xranges::find_last(bytes, '\n').begin() == bytes.end() - 1);
+}
+
+constexpr bool test_constexpr() {
+    char const text[] = "find the last letter t in this text";
+    std::span<char const> range(text, sizeof(text) - 1);
+    assert(xranges::contains(range, 'x'));
+    assert(!xranges::contains(range, 'z'));
+    assert(xranges::find_last(range, 't').begin() == range.end() - 1);
+    assert(xranges::find_last(range, 'f').begin() == range.begin());
+
+    std::uint32_t const words[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+    assert(xranges::contains(words, 9u));
+    assert(xranges::find_last(words, 5u).begin() == words + 10);
+    assert(xranges::find_last(words, 7u).begin() == std::end(words));
+    return true;
+}
+
+int main(int, char**) {
+    test_type<char>();
+    test_type<signed char>();
+    test_type<unsigned char>();
+    test_type<char8_t>();
+    test_type<std::int16_t>();
+    test_type<std::uint16_t>();
+    test_type<std::int32_t>();
+    test_type<std::uint32_t>();
+    test_type<std::int64_t>();
+    test_type<std::uint64_t>();
+    test_wider_value();
+    test_agrees_with_generic();
+
+    test_constexpr();
+    static_assert(test_constexpr());
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+// Copyright 2025 Bryan Wong
+
+// contains_subrange over contiguous ranges of bytes and integers may use a
+// vectorised first/last element filter for short needles and a Two-Way or
+// Horspool search for long ones. These tests cover both sides of the switch,
+// periodic needles that defeat naive skip tables, and check the results
+// against the generic search taken when a predicate or projection is given.
+
+#include "rxx/algorithm/contains.h"
+
+#include "generic_path.h"
+#include "rxx/ranges.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+
+bool contains(std::string_view haystack, std::string_view needle) {
+    bool const result = xranges::contains_subrange(haystack, needle);
+    assert(result ==
+        xranges::contains_subrange(haystack, needle, {}, generic, generic));
+    assert(result == (haystack.find(needle) != haystack.npos));
+    return result;
+}
+
+void test_needle_lengths() {
+    // Every needle length up to past two 256-bit vectors, matched at every
+    // position of a haystack whose other bytes share the first and last byte
+    // of the needle.
+    for (std::size_t length = 1; length <= 72; ++length) {
+        std::string needle(length, 'b');
+        needle.front() = 'a';
+        needle.back() = 'c';
+        if (length == 1)
+            needle = "a";
+        for (std::size_t pos = 0; pos != 100; ++pos) {
+            std::string haystack(pos + length + 37, 'x');
+            for (std::size_t i = 0; i < haystack.size(); i += 3)
+                haystack[i] = needle.front();
+            for (std::size_t i = 2; i < haystack.size(); i += 5)
+                haystack[i] = needle.back();
+
+            bool const expected = haystack.find(needle) != haystack.npos;
+            assert(contains(haystack, needle) == expected);
+            haystack.replace(pos, length, needle);
+            assert(contains(haystack, needle));
+            // One byte off in the middle no longer matches there.
+            if (length > 2) {
+                haystack[pos + length / 2] = 'y';
+                assert(contains(haystack, needle) ==
+                    (haystack.find(needle) != haystack.npos));
+            }
+        }
+    }
+}
+
+void test_edge_cases() {
+    assert(contains("", ""));
+    assert(contains("abc", ""));
+    assert(!contains("", "a"));
+    assert(!contains("ab", "abc"));
+    assert(contains("abc", "abc"));
+    assert(contains("abc", "c"));
+    assert(!contains(std::string(1000, 'a'), std::string(1001, 'a')));
+    assert(contains(std::string(1000, 'a'), std::string(1000, 'a')));
+
+    // Embedded and trailing null bytes are ordinary bytes.
+    using namespace std::string_view_literals;
+    assert(contains("a\0b\0c"sv, "\0c"sv));
+    assert(!contains("a\0b\0c"sv, "\0\0"sv));
+
+    // Periodic needles and haystacks where a match is found only after many
+    // partial ones.
+    std::string haystack(4096, 'a');
+    std::string needle = std::string(63, 'a') + 'b';
+    assert(!contains(haystack, needle));
+    haystack.back() = 'b';
+    assert(contains(haystack, needle));
+    assert(contains("abababababac", "ababac"));
+    assert(!contains("abababababab", "ababac"));
+    assert(contains("aabaabaabaaab", "aabaaab"));
+    assert(contains("xyzxyzxyzxyzxyzxyzxyzxyzxyzxyzxyzxyz!", "zxyz!"));
+
+    // Bytes with the high bit set must not be sign extended or truncated.
+    std::string high = "\x7f\x80\xff\x80\x81\xfe";
+    assert(contains(high, "\xff\x80"));
+    assert(!contains(high, "\x80\xff\x81"));
+}
+
+void test_integers() {
+    std::vector<std::uint32_t> haystack;
+    for (std::uint32_t i = 0; i != 2000; ++i)
+        haystack.push_back(i % 7 == 0 ? 0xdeadbeefu : i % 3);
+    for (std::size_t length = 1; length != 40; ++length) {
+        for (std::size_t pos = 0; pos + length <= haystack.size();
+             pos += 97) {
+            std::span<std::uint32_t const> needle(
+                haystack.data() + pos, length);
+            assert(xranges::contains_subrange(haystack, needle));
+            assert(xranges::contains_subrange(
+                haystack, needle, {}, generic, generic));
+        }
+    }
+    std::uint32_t const missing[] = {0xdeadbeefu, 0xdeadbeefu};
+    assert(!xranges::contains_subrange(haystack, missing));
+
+    // Values that only differ in one byte of the element.
+    std::vector<std::uint16_t> shorts = {0x0101, 0x0102, 0x0201, 0x0202};
+    std::uint16_t const pattern[] = {0x0102, 0x0201};
+    std::uint16_t const swapped[] = {0x0201, 0x0102};
+    assert(xranges::contains_subrange(shorts, pattern));
+    assert(!xranges::contains_subrange(shorts, swapped));
+}
+
+void test_predicates_and_projections() {
+    // Non-default predicates and projections keep their exact semantics.
+    std::string_view const haystack = "The Quick Brown Fox";
+    auto const case_insensitive = [](char a, char b) {
+        auto lower = [](char c) {
+            return c >= 'A' && c <= 'Z' ? static_cast<char>(c + 32) : c;
+        };
+        return lower(a) == lower(b);
+    };
+    assert(!xranges::contains_subrange(haystack, std::string_view("quick")));
+    assert(xranges::contains_subrange(
+        haystack, std::string_view("quick"), case_insensitive));
+    auto const upper = [](char c) { return c & ~0x20; };
+    assert(xranges::contains_subrange(
+        haystack, std::string_view("QUICK"), {}, upper, upper));
+
+    std::vector<int> numbers = {1, 2, 3, 4, 5, 6, 7, 8};
+    int const doubled[] = {6, 8, 10};
+    assert(xranges::contains_subrange(
+        numbers, doubled, {}, [](int i) { return i * 2; }));
+    int const bounds[] = {2, 3, 4};
+    int const ones[] = {1, 1, 1};
+    assert(xranges::contains_subrange(numbers, bounds, std::less<>()));
+    assert(!xranges::contains_subrange(numbers, ones, std::less<>()));
+}
+
+constexpr bool test_constexpr() {
+    std::string_view const text = "constant evaluation takes the plain path";
+    assert(xranges::contains_subrange(text, std::string_view("plain")));
+    assert(xranges::contains_subrange(text, std::string_view("n p")));
+    assert(!xranges::contains_subrange(text, std::string_view("planet")));
+
+    int const numbers[] = {1, 2, 3, 1, 2, 4};
+    int const found[] = {1, 2, 4};
+    int const missing[] = {2, 4, 1};
+    assert(xranges::contains_subrange(numbers, found));
+    assert(!xranges::contains_subrange(numbers, missing));
+    return true;
+}
+
+int main(int, char**) {
+    test_needle_lengths();
+    test_edge_cases();
+    test_integers();
+    test_predicates_and_projections();
+
+    test_constexpr();
+    static_assert(test_constexpr());
+
+    return 0;
+}
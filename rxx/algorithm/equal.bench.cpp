@@ -0,0 +1,108 @@
+// Copyright 2025 Bryan Wong
+
+// equal, starts_with and ends_with over contiguous ranges, against the
+// element by element comparison taken when a projection is given.
+
+#include "rxx/algorithm/ends_with.h"
+#include "rxx/algorithm/equal.h"
+#include "rxx/algorithm/starts_with.h"
+
+#include "../benchmark.h"
+#include "generic_path.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 20;
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    {
+        std::vector<std::uint8_t> left(count);
+        for (std::size_t i = 0; i != count; ++i)
+            left[i] = static_cast<std::uint8_t>(i * 31);
+        auto const right = left;
+
+        compare_generic(
+            suite, "equal/vector<uint8_t>", count,
+            [&] { xtests::do_not_optimize(xranges::equal(left, right)); },
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::equal(left, right, {}, generic, generic));
+            });
+    }
+
+    {
+        std::vector<std::uint32_t> left(count / 4);
+        for (std::size_t i = 0; i != left.size(); ++i)
+            left[i] = static_cast<std::uint32_t>(i * 2654435761u);
+        auto const right = left;
+
+        compare_generic(
+            suite, "equal/vector<uint32_t>", left.size(),
+            [&] { xtests::do_not_optimize(xranges::equal(left, right)); },
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::equal(left, right, {}, generic, generic));
+            });
+    }
+
+    {
+        // Many short serialised messages checked against a header and a
+        // trailer, the protocol parsing hot path.
+        constexpr std::size_t messages = 4096;
+        using namespace std::string_view_literals;
+        std::string_view const header = "\x0a\x10rxx.bench.frame"sv;
+        std::string_view const trailer = "\x00\x00\xde\xad\xbe\xef"sv;
+        std::vector<std::string> frames;
+        frames.reserve(messages);
+        for (std::size_t i = 0; i != messages; ++i) {
+            std::string frame(header);
+            frame.append(16 + i % 48, 'p');
+            frame.append(trailer);
+            frames.push_back(std::move(frame));
+        }
+        std::span<char const> prefix(header.data(), header.size());
+        std::span<char const> suffix(trailer.data(), trailer.size());
+
+        compare_generic(
+            suite, "starts_with/frames", messages,
+            [&] {
+                std::size_t matches = 0;
+                for (auto const& frame : frames)
+                    matches += xranges::starts_with(frame, prefix);
+                xtests::do_not_optimize(matches);
+            },
+            [&] {
+                std::size_t matches = 0;
+                for (auto const& frame : frames)
+                    matches += xranges::starts_with(
+                        frame, prefix, {}, generic, generic);
+                xtests::do_not_optimize(matches);
+            });
+        compare_generic(
+            suite, "ends_with/frames", messages,
+            [&] {
+                std::size_t matches = 0;
+                for (auto const& frame : frames)
+                    matches += xranges::ends_with(frame, suffix);
+                xtests::do_not_optimize(matches);
+            },
+            [&] {
+                std::size_t matches = 0;
+                for (auto const& frame : frames)
+                    matches += xranges::ends_with(
+                        frame, suffix, {}, generic, generic);
+                xtests::do_not_optimize(matches);
+            });
+    }
+}
@@ -0,0 +1,179 @@
+// Copyright 2025 Bryan Wong
+
+// Execution policy overloads of the rxx algorithms. Random access sized
+// ranges are split into chunks processed on the built-in thread pool, other
+// ranges run sequentially. Every overload must produce the sequential result,
+// for sizes on both sides of the chunking threshold and for any pool size.
+
+#include "rxx/algorithm.h"
+
+#if RXX_SUPPORTS_EXECUTION_POLICIES
+#  include "rxx/ranges.h"
+
+#  include <atomic>
+#  include <cassert>
+#  include <cstddef>
+#  include <cstdint>
+#  include <forward_list>
+#  include <functional>
+#  include <numeric>
+#  include <string>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xexecution = __RXX execution;
+
+constexpr std::size_t sizes[] = {0, 1, 2, 7, 64, 1000, 4097, 100003};
+
+template <typename Policy>
+void test_fold(Policy const& policy) {
+    for (std::size_t size : sizes) {
+        // The largest sum does not fit in a 32-bit long.
+        std::vector<std::int64_t> values(size);
+        std::iota(values.begin(), values.end(), std::int64_t(1));
+        auto const n = static_cast<std::int64_t>(size);
+        std::int64_t const sum = n * (n + 1) / 2;
+
+        assert(xranges::fold_left(policy, values, std::int64_t(0),
+                   std::plus()) == sum);
+        assert(xranges::fold_left(policy, values.begin(), values.end(),
+                   std::int64_t(5), std::plus()) == sum + 5);
+        assert(xranges::fold_right(policy, values, std::int64_t(0),
+                   std::plus()) == sum);
+
+        // Associative but not commutative: chunks are combined in order.
+        std::vector<std::string> letters(size);
+        std::string expected;
+        for (std::size_t i = 0; i != size; ++i) {
+            letters[i] = static_cast<char>('a' + i % 26);
+            expected += letters[i];
+        }
+        assert(xranges::fold_left(policy, letters, std::string(),
+                   std::plus()) == expected);
+        assert(xranges::fold_right(policy, letters, std::string(),
+                   std::plus()) == expected);
+    }
+}
+
+template <typename Policy>
+void test_search(Policy const& policy) {
+    for (std::size_t size : sizes) {
+        std::vector<int> values(size, 0);
+        assert(!xranges::contains(policy, values, 1));
+        assert(xranges::find_last(policy, values, 1).begin() == values.end());
+
+        for (std::size_t pos : {std::size_t(0), size / 3, size / 2, size - 1}) {
+            if (pos >= size)
+                continue;
+            values[pos] = 1;
+            assert(xranges::contains(policy, values, 1));
+            assert(xranges::contains(
+                policy, values.begin(), values.end(), 1));
+            auto last = xranges::find_last(policy, values, 1);
+            assert(last.begin() == values.begin() + pos);
+            assert(last.end() == values.end());
+        }
+
+        // Of several matches in different chunks, the last one wins.
+        if (size > 1) {
+            values.front() = 2;
+            values.back() = 2;
+            assert(xranges::find_last(policy, values, 2).begin() ==
+                values.end() - 1);
+        }
+    }
+}
+
+template <typename Policy>
+void test_compare(Policy const& policy) {
+    for (std::size_t size : sizes) {
+        std::vector<int> left(size);
+        std::iota(left.begin(), left.end(), 0);
+        auto right = left;
+        assert(xranges::equal(policy, left, right));
+        assert(xranges::starts_with(policy, left, right));
+
+        if (size == 0)
+            continue;
+        right.back() = -1;
+        assert(!xranges::equal(policy, left, right));
+        assert(!xranges::starts_with(policy, left, right));
+        right.pop_back();
+        assert(xranges::starts_with(policy, left, right));
+        assert(!xranges::equal(policy, left, right));
+    }
+}
+
+template <typename Policy>
+void test_shift(Policy const& policy) {
+    for (std::size_t size : sizes) {
+        for (std::size_t n : {std::size_t(0), std::size_t(1), size / 2, size,
+                 size + 1}) {
+            std::vector<int> values(size);
+            std::iota(values.begin(), values.end(), 0);
+            auto result = xranges::shift_left(
+                policy, values, static_cast<std::ptrdiff_t>(n));
+            std::size_t const kept = n < size ? size - n : 0;
+            assert(result.begin() == values.begin());
+            assert(static_cast<std::size_t>(result.size()) ==
+                (n == 0 ? size : kept));
+            for (std::size_t i = 0; i != kept && n != 0; ++i)
+                assert(values[i] == static_cast<int>(i + n));
+        }
+    }
+}
+
+// Predicates may be called concurrently and at most once per element.
+template <typename Policy>
+void test_concurrent_calls(Policy const& policy) {
+    std::vector<int> values(100003);
+    std::iota(values.begin(), values.end(), 0);
+    std::atomic<std::size_t> calls = 0;
+    auto const projection = [&](int value) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        return value;
+    };
+    assert(!xranges::contains(policy, values, -1, projection));
+    assert(calls.load() == values.size());
+}
+
+// Non random access ranges are accepted and processed sequentially.
+template <typename Policy>
+void test_sequential_fallback(Policy const& policy) {
+    std::forward_list<int> list = {1, 2, 3, 4, 5};
+    assert(xranges::fold_left(policy, list, 0, std::plus()) == 15);
+    assert(xranges::contains(policy, list, 4));
+    assert(xranges::find_last(policy, list, 3).begin() ==
+        std::next(list.begin(), 2));
+}
+
+template <typename Policy>
+void test_policy(Policy const& policy) {
+    test_fold(policy);
+    test_search(policy);
+    test_compare(policy);
+    test_shift(policy);
+    test_concurrent_calls(policy);
+    test_sequential_fallback(policy);
+}
+
+int main(int, char**) {
+    test_policy(xexecution::seq);
+    test_policy(xexecution::unseq);
+    test_policy(xexecution::par);
+    test_policy(xexecution::par_unseq);
+
+    for (std::size_t threads : {1, 2, 3, 8}) {
+        xexecution::thread_pool pool(threads);
+        assert(pool.size() == threads);
+        test_policy(xexecution::par.on(pool));
+        test_policy(xexecution::par_unseq.on(pool));
+    }
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
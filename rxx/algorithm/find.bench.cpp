@@ -0,0 +1,99 @@
+// Copyright 2025 Bryan Wong
+
+// contains and find_last over large contiguous ranges of scalars, against the
+// generic element by element loop taken when a projection is given.
+
+#include "rxx/algorithm/contains.h"
+#include "rxx/algorithm/find_last.h"
+
+#include "../benchmark.h"
+#include "generic_path.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 20;
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    {
+        // A log buffer without the byte searched for, the worst case.
+        std::vector<char> buffer(count);
+        for (std::size_t i = 0; i != count; ++i)
+            buffer[i] = static_cast<char>(i % 79 == 78 ? '\n' : 'a' + i % 26);
+        std::span<char const> bytes(buffer);
+
+        compare_generic(
+            suite, "contains/span<const char>", count,
+            [&] { xtests::do_not_optimize(xranges::contains(bytes, '\t')); },
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::contains(bytes, '\t', generic));
+            });
+        compare_generic(
+            suite, "find_last/span<const char>", count,
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::find_last(bytes, '\t').begin());
+            },
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::find_last(bytes, '\t', generic).begin());
+            });
+        // The last newline is close to the end, the best case for find_last.
+        compare_generic(
+            suite, "find_last/span<const char>/near end", count,
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::find_last(bytes, '\n').begin());
+            },
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::find_last(bytes, '\n', generic).begin());
+            });
+    }
+
+    {
+        std::vector<std::uint32_t> words(count);
+        for (std::size_t i = 0; i != count; ++i)
+            words[i] = static_cast<std::uint32_t>(i * 2654435761u) | 1u;
+
+        compare_generic(
+            suite, "contains/vector<uint32_t>", count,
+            [&] { xtests::do_not_optimize(xranges::contains(words, 0u)); },
+            [&] {
+                xtests::do_not_optimize(xranges::contains(words, 0u, generic));
+            });
+        compare_generic(
+            suite, "find_last/vector<uint32_t>", count,
+            [&] {
+                xtests::do_not_optimize(xranges::find_last(words, 0u).begin());
+            },
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::find_last(words, 0u, generic).begin());
+            });
+    }
+
+    {
+        std::vector<std::uint64_t> words(count / 2, 7);
+
+        compare_generic(
+            suite, "contains/vector<uint64_t>", count / 2,
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::contains(words, std::uint64_t(3)));
+            },
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::contains(words, std::uint64_t(3), generic));
+            });
+    }
+}
@@ -0,0 +1,79 @@
+// Copyright 2025 Bryan Wong
+
+// fold_left_unordered and fold_left_pairwise against the strictly sequential
+// fold_left over arithmetic ranges.
+
+#include "rxx/algorithm/fold.h"
+
+#if RXX_SUPPORTS_UNORDERED_FOLD
+#  include "rxx/algorithm/minmax.h"
+
+#  include "../benchmark.h"
+
+#  include <cstddef>
+#  include <cstdint>
+#  include <functional>
+#  include <string>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 20;
+
+template <typename T, typename Op>
+void compare_folds(xtests::benchmark_suite& suite, std::string const& group,
+    std::vector<T> const& values, T init, Op op) {
+    suite.run(group, "fold_left", values.size(), [&] {
+        xtests::do_not_optimize(xranges::fold_left(values, init, op));
+    });
+    suite.run(group, "unordered", values.size(), [&] {
+        xtests::do_not_optimize(
+            xranges::fold_left_unordered(values, init, op));
+    });
+    suite.run(group, "pairwise", values.size(), [&] {
+        xtests::do_not_optimize(xranges::fold_left_pairwise(values, init, op));
+    });
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    {
+        std::vector<float> values(count);
+        for (std::size_t i = 0; i != count; ++i)
+            values[i] = static_cast<float>(i % 1000) * 0.001f;
+        compare_folds(suite, "float/plus", values, 0.0f, std::plus());
+        compare_folds(suite, "float/max", values, 0.0f, xranges::max);
+    }
+
+    {
+        std::vector<double> values(count);
+        for (std::size_t i = 0; i != count; ++i)
+            values[i] = 1.0 / static_cast<double>(i + 1);
+        compare_folds(suite, "double/plus", values, 0.0, std::plus());
+        compare_folds(suite, "double/multiplies", values, 1.0,
+            std::multiplies());
+    }
+
+    {
+        std::vector<std::int32_t> values(count);
+        for (std::size_t i = 0; i != count; ++i)
+            values[i] = static_cast<std::int32_t>(i * 2654435761u);
+        compare_folds(suite, "int32_t/min", values, std::int32_t(0),
+            xranges::min);
+    }
+
+    {
+        std::vector<std::uint64_t> values(count);
+        for (std::size_t i = 0; i != count; ++i)
+            values[i] = i * 0x9e3779b97f4a7c15u;
+        compare_folds(suite, "uint64_t/plus", values, std::uint64_t(0),
+            std::plus());
+    }
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,174 @@
+// Copyright 2025 Bryan Wong
+
+// fold_left_unordered may reassociate and reorder the operation, so it can
+// use several accumulators and SIMD lanes for arithmetic types with
+// std::plus, std::multiplies, ranges::min and ranges::max. fold_left_pairwise
+// always combines in the same balanced tree, so floating point results are
+// reproducible across builds and instruction sets:
+//   pairwise([x]) = x
+//   pairwise(r)   = op(pairwise(first n/2), pairwise(last n - n/2))
+//   fold_left_pairwise(r, init, op) = op(init, pairwise(r)), or init if empty
+
+#include "rxx/algorithm/fold.h"
+
+#if RXX_SUPPORTS_UNORDERED_FOLD
+#  include "rxx/algorithm/minmax.h"
+#  include "rxx/ranges.h"
+
+#  include <cassert>
+#  include <cmath>
+#  include <concepts>
+#  include <cstddef>
+#  include <cstdint>
+#  include <forward_list>
+#  include <functional>
+#  include <limits>
+#  include <span>
+#  include <type_traits>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+
+constexpr std::size_t sizes[] = {0, 1, 2, 3, 7, 8, 15, 16, 17, 31, 33, 64,
+    100, 1023, 4096, 10007};
+
+template <typename T, typename Op>
+T pairwise(std::span<T const> values, Op op) {
+    if (values.size() == 1)
+        return values.front();
+    std::size_t const half = values.size() / 2;
+    return op(pairwise(values.first(half), op),
+        pairwise(values.subspan(half), op));
+}
+
+template <typename T, typename Op>
+T reference_pairwise(std::vector<T> const& values, T init, Op op) {
+    if (values.empty())
+        return init;
+    return op(init, pairwise(std::span<T const>(values), op));
+}
+
+template <typename T>
+void test_integers() {
+    for (std::size_t size : sizes) {
+        std::vector<T> values(size);
+        for (std::size_t i = 0; i != size; ++i)
+            values[i] = static_cast<T>((i * 2654435761u) % 1000);
+
+        auto const sum = xranges::fold_left(values, T(3), std::plus());
+        assert(xranges::fold_left_unordered(values, T(3), std::plus()) == sum);
+        assert(xranges::fold_left_unordered(
+                   values.begin(), values.end(), T(3), std::plus()) == sum);
+        assert(xranges::fold_left_pairwise(values, T(3), std::plus()) == sum);
+
+        // Unsigned products wrap identically in any order.
+        if constexpr (std::is_unsigned_v<decltype(T() * T())>) {
+            std::vector<T> odd(values);
+            for (T& value : odd)
+                value |= 1;
+            auto const product =
+                xranges::fold_left(odd, T(1), std::multiplies());
+            assert(xranges::fold_left_unordered(
+                       odd, T(1), std::multiplies()) == product);
+        }
+
+        T const low = xranges::fold_left(values, T(500), xranges::min);
+        T const high = xranges::fold_left(values, T(500), xranges::max);
+        assert(xranges::fold_left_unordered(values, T(500), xranges::min) ==
+            low);
+        assert(xranges::fold_left_unordered(values, T(500), xranges::max) ==
+            high);
+    }
+}
+
+template <typename T>
+void test_floating_point() {
+    for (std::size_t size : sizes) {
+        std::vector<T> values(size);
+        long double exact = 0.5L;
+        for (std::size_t i = 0; i != size; ++i) {
+            values[i] = static_cast<T>(1.0 / (1.0 + static_cast<double>(i)));
+            exact += values[i];
+        }
+
+        // Any association is within a few ulps per element of the exact sum.
+        T const unordered =
+            xranges::fold_left_unordered(values, T(0.5), std::plus());
+        auto const tolerance = static_cast<long double>(
+            std::numeric_limits<T>::epsilon() * (size + 1) * exact);
+        assert(std::fabs(static_cast<long double>(unordered) - exact) <=
+            tolerance);
+
+        // The pairwise tree is bit for bit reproducible.
+        T const expected = reference_pairwise(values, T(0.5), std::plus());
+        T const result =
+            xranges::fold_left_pairwise(values, T(0.5), std::plus());
+        assert(result == expected);
+        assert(xranges::fold_left_pairwise(values, T(0.5), std::plus()) ==
+            result);
+
+        // min and max are exact in any order.
+        assert(xranges::fold_left_unordered(values, T(2), xranges::min) ==
+            xranges::fold_left(values, T(2), xranges::min));
+        assert(xranges::fold_left_unordered(values, T(-2), xranges::max) ==
+            xranges::fold_left(values, T(-2), xranges::max));
+    }
+
+    // Non-finite values propagate as they do sequentially.
+    std::vector<T> values(100, T(1));
+    values[63] = std::numeric_limits<T>::infinity();
+    assert(std::isinf(xranges::fold_left_unordered(values, T(0), std::plus())));
+    values[17] = -std::numeric_limits<T>::infinity();
+    assert(std::isnan(xranges::fold_left_unordered(values, T(0), std::plus())));
+    assert(std::isnan(xranges::fold_left_pairwise(values, T(0), std::plus())));
+}
+
+// Other associative and commutative operations and other ranges take the
+// generic path.
+void test_generic() {
+    auto const bit_xor = [](unsigned a, unsigned b) { return a ^ b; };
+    std::vector<unsigned> values = {1, 2, 4, 8, 16, 3};
+    assert(xranges::fold_left_unordered(values, 0u, bit_xor) == 28);
+    assert(xranges::fold_left_pairwise(values, 0u, bit_xor) == 28);
+
+    std::forward_list<long> list = {1, 2, 3, 4};
+    assert(xranges::fold_left_unordered(list, 0L, std::plus()) == 10);
+    assert(xranges::fold_left_pairwise(list, 0L, std::plus()) == 10);
+
+    // The result type is that of fold_left.
+    std::vector<int> ints = {1, 2, 3};
+    static_assert(std::same_as<decltype(xranges::fold_left_unordered(
+                                   ints, 0.5, std::plus())),
+        double>);
+    assert(xranges::fold_left_unordered(ints, 0.5, std::plus()) == 6.5);
+}
+
+constexpr bool test_constexpr() {
+    int const values[] = {5, 3, 8, 1, 9, 2};
+    assert(xranges::fold_left_unordered(values, 0, std::plus()) == 28);
+    assert(xranges::fold_left_unordered(values, 100, xranges::min) == 1);
+    assert(xranges::fold_left_pairwise(values, 0, std::plus()) == 28);
+    double const halves[] = {0.5, 0.25, 0.125};
+    assert(xranges::fold_left_pairwise(halves, 0.0, std::plus()) == 0.875);
+    return true;
+}
+
+int main(int, char**) {
+    test_integers<int>();
+    test_integers<std::uint8_t>();
+    test_integers<std::uint32_t>();
+    test_integers<std::int64_t>();
+    test_floating_point<float>();
+    test_floating_point<double>();
+    test_generic();
+
+    test_constexpr();
+    static_assert(test_constexpr());
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,21 @@
+// Copyright 2025 Bryan Wong
+
+// Helpers for checking the contiguous fast paths of the searching and
+// comparing algorithms against the generic path they take otherwise.
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+// An identity projection. Passing any projection forces the generic element
+// by element path.
+inline constexpr auto generic = [](auto const& value) { return value; };
+
+// Benchmarks `fast` as "rxx" and `slow` as "generic" in the same group.
+template <typename Suite, typename Fast, typename Generic>
+void compare_generic(Suite& suite, std::string_view group, std::size_t items,
+    Fast&& fast, Generic&& slow) {
+    suite.run(group, "rxx", items, fast);
+    suite.run(group, "generic", items, slow);
+}
@@ -0,0 +1,72 @@
+// Copyright 2025 Bryan Wong
+
+// Scaling of the parallel algorithm overloads from one thread to every
+// hardware thread, against the sequential overload.
+
+#include "rxx/algorithm.h"
+
+#if RXX_SUPPORTS_EXECUTION_POLICIES
+#  include "../benchmark.h"
+
+#  include <algorithm>
+#  include <cstddef>
+#  include <cstdint>
+#  include <functional>
+#  include <string>
+#  include <thread>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xexecution = __RXX execution;
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 24;
+
+template <typename Body>
+void scale(xtests::benchmark_suite& suite, std::string const& group,
+    Body const& body) {
+    suite.run(group, "seq", count, [&] { body(xexecution::seq); });
+
+    std::size_t const hardware =
+        std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1;; threads *= 2) {
+        threads = std::min(threads, hardware);
+        xexecution::thread_pool pool(threads);
+        suite.run(group, "par/" + std::to_string(threads) + " threads", count,
+            [&] { body(xexecution::par.on(pool)); });
+        if (threads == hardware)
+            break;
+    }
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    std::vector<std::uint32_t> values(count);
+    for (std::size_t i = 0; i != count; ++i)
+        values[i] = static_cast<std::uint32_t>(i * 2654435761u) >> 8;
+    auto const copy = values;
+
+    scale(suite, "fold_left/plus", [&](auto const& policy) {
+        xtests::do_not_optimize(xranges::fold_left(
+            policy, values, std::uint64_t(0), std::plus<std::uint64_t>()));
+    });
+    // The only match is the first element, the worst case for find_last.
+    values.front() = 0xffffffffu;
+    scale(suite, "find_last/first element", [&](auto const& policy) {
+        xtests::do_not_optimize(
+            xranges::find_last(policy, values, 0xffffffffu).begin());
+    });
+    scale(suite, "contains/absent", [&](auto const& policy) {
+        xtests::do_not_optimize(xranges::contains(policy, values, 1u << 30));
+    });
+    values.front() = copy.front();
+    scale(suite, "equal/identical", [&](auto const& policy) {
+        xtests::do_not_optimize(xranges::equal(policy, values, copy));
+    });
+}
+#else
+int main() {
+    return 0;
+}
+#endif
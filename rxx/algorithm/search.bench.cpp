@@ -0,0 +1,83 @@
+// Copyright 2025 Bryan Wong
+
+// contains_subrange over large contiguous buffers for short and long needles,
+// against the generic search taken when a projection is given.
+
+#include "rxx/algorithm/contains.h"
+
+#include "../benchmark.h"
+#include "generic_path.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 20;
+
+template <typename Haystack, typename Needle>
+void compare_search(xtests::benchmark_suite& suite, std::string_view group,
+    Haystack const& haystack, Needle const& needle) {
+    compare_generic(
+        suite, group, xranges::size(haystack),
+        [&] {
+            xtests::do_not_optimize(
+                xranges::contains_subrange(haystack, needle));
+        },
+        [&] {
+            xtests::do_not_optimize(xranges::contains_subrange(
+                haystack, needle, {}, generic, generic));
+        });
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    {
+        // English-like text, the needles are absent so the whole buffer is
+        // scanned.
+        std::string text;
+        text.reserve(count);
+        std::string_view const words[] = {"the ", "quick ", "brown ", "fox ",
+            "jumps ", "over ", "a ", "lazy ", "dog\n"};
+        for (std::size_t i = 0; text.size() < count; ++i)
+            text += words[(i * 7) % std::size(words)];
+        std::span<char const> bytes(text.data(), count);
+
+        std::string const needles[] = {
+            "fax", "the lazy dog", std::string(16, 'q'),
+            "the quick brown fox jumps over the lazy cat\n",
+            std::string(256, 'x')};
+        for (auto const& needle : needles) {
+            std::string const group = "contains_subrange/text/needle " +
+                std::to_string(needle.size());
+            compare_search(suite, group, bytes,
+                std::span<char const>(needle.data(), needle.size()));
+        }
+    }
+
+    {
+        // Binary data where the first and last byte of the needle are common.
+        std::vector<std::uint8_t> data(count);
+        for (std::size_t i = 0; i != count; ++i)
+            data[i] = static_cast<std::uint8_t>((i * 131) >> 3);
+        std::vector<std::uint8_t> needle(32, 0x10);
+        needle.back() = 0x20;
+        compare_search(
+            suite, "contains_subrange/bytes/needle 32", data, needle);
+    }
+
+    {
+        std::vector<std::uint32_t> data(count / 4);
+        for (std::size_t i = 0; i != data.size(); ++i)
+            data[i] = static_cast<std::uint32_t>(i % 1024);
+        std::uint32_t const needle[] = {5, 6, 7, 9};
+        compare_search(
+            suite, "contains_subrange/uint32_t/needle 4", data, needle);
+    }
+}
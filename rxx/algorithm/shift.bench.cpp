@@ -0,0 +1,94 @@
+// Copyright 2025 Bryan Wong
+
+// shift_left and shift_right used as a sliding window over a buffer of PODs
+// and of strings, against std::shift_left and std::shift_right.
+
+#include "rxx/algorithm/shift.h"
+
+#include "../benchmark.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+struct sample {
+    std::uint64_t timestamp;
+    double value;
+};
+
+constexpr std::size_t count = 4096;
+
+template <typename T, typename Make>
+void bench_window(xtests::benchmark_suite& suite, std::string const& name,
+    Make make) {
+    std::vector<T> rxx_buffer;
+    std::vector<T> std_buffer;
+    std::vector<T> incoming;
+    for (std::size_t i = 0; i != count; ++i) {
+        rxx_buffer.push_back(make(i));
+        std_buffer.push_back(make(i));
+    }
+    for (std::size_t i = 0; i != 16; ++i)
+        incoming.push_back(make(count + i));
+
+    // Drop the oldest 16 entries and append new ones in their place.
+    suite.compare(
+        name + "/shift_left 16", count,
+        [&] {
+            auto kept = xranges::shift_left(rxx_buffer, 16);
+            std::copy(incoming.begin(), incoming.end(), kept.end());
+        },
+        [&] {
+            auto end =
+                std::shift_left(std_buffer.begin(), std_buffer.end(), 16);
+            std::copy(incoming.begin(), incoming.end(), end);
+        });
+    suite.compare(
+        name + "/shift_right 1", count,
+        [&] {
+            auto kept = xranges::shift_right(rxx_buffer, 1);
+            rxx_buffer.front() = incoming.front();
+            xtests::do_not_optimize(kept.begin());
+        },
+        [&] {
+            auto begin =
+                std::shift_right(std_buffer.begin(), std_buffer.end(), 1);
+            std_buffer.front() = incoming.front();
+            xtests::do_not_optimize(begin);
+        });
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    bench_window<int>(suite, "vector<int>",
+        [](std::size_t i) { return static_cast<int>(i); });
+    bench_window<sample>(suite, "vector<sample>", [](std::size_t i) {
+        return sample{i, static_cast<double>(i) * 0.5};
+    });
+    bench_window<std::string>(suite, "vector<string>", [](std::size_t i) {
+        return std::string(8 + i % 32, static_cast<char>('a' + i % 26));
+    });
+
+    {
+        // A bidirectional range: shift_right must not buffer the elements.
+        std::list<int> rxx_list(count / 4, 1);
+        std::list<int> std_list(count / 4, 1);
+        suite.compare(
+            "list<int>/shift_right 8", count / 4,
+            [&] {
+                xtests::do_not_optimize(
+                    xranges::shift_right(rxx_list, 8).begin());
+            },
+            [&] {
+                xtests::do_not_optimize(
+                    std::shift_right(std_list.begin(), std_list.end(), 8));
+            });
+    }
+}
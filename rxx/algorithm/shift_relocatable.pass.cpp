@@ -0,0 +1,197 @@
+// Copyright 2025 Bryan Wong
+
+// shift_left and shift_right over contiguous ranges of trivially copyable or
+// trivially relocatable types may move the elements with a single memmove.
+// The shifted elements must compare equal to the originals, the elements
+// left behind must still be valid objects, and the number of assignments
+// must never exceed the (last - first) - n the standard allows for any
+// iterator category.
+
+#include "rxx/algorithm/shift.h"
+
+#if RXX_SUPPORTS_TRIVIALLY_RELOCATABLE
+#  include "rxx/type_traits/is_trivially_relocatable.h"
+
+#  include "../../llvm/test_iterators.h"
+#  include "rxx/ranges.h"
+
+#  include <cassert>
+#  include <cstddef>
+#  include <cstdint>
+#  include <list>
+#  include <string>
+#  include <type_traits>
+#  include <utility>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+
+// Owns a heap allocated value and opts in as trivially relocatable.
+class boxed {
+public:
+    boxed() = default;
+    explicit boxed(int value) : ptr_(new int(value)) {}
+    boxed(boxed const& other)
+        : ptr_(other.ptr_ ? new int(*other.ptr_) : nullptr) {}
+    boxed(boxed&& other) noexcept : ptr_(std::exchange(other.ptr_, nullptr)) {}
+    boxed& operator=(boxed other) noexcept {
+        std::swap(ptr_, other.ptr_);
+        return *this;
+    }
+    ~boxed() { delete ptr_; }
+
+    friend bool operator==(boxed const& left, int right) {
+        return left.ptr_ && *left.ptr_ == right;
+    }
+
+private:
+    int* ptr_ = nullptr;
+};
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+template <>
+struct is_trivially_relocatable<boxed> : std::true_type {};
+RXX_DEFAULT_NAMESPACE_END
+
+// Counts assignments, to check the bound of the standard.
+struct assignment_counted {
+    static inline int assignments = 0;
+
+    int value = 0;
+
+    assignment_counted(int v = 0) : value(v) {}
+    assignment_counted(assignment_counted const&) = default;
+    assignment_counted(assignment_counted&&) = default;
+    assignment_counted& operator=(assignment_counted const& other) {
+        ++assignments;
+        value = other.value;
+        return *this;
+    }
+    assignment_counted& operator=(assignment_counted&& other) {
+        ++assignments;
+        value = other.value;
+        return *this;
+    }
+
+    friend bool operator==(assignment_counted const& left, int right) {
+        return left.value == right;
+    }
+};
+
+template <class T>
+T make(int value) {
+    if constexpr (std::is_same_v<T, std::string>)
+        return std::string(40, static_cast<char>('a' + value % 26)) +
+            std::to_string(value);
+    else
+        return T(value);
+}
+
+template <class T>
+bool holds(T const& element, int value) {
+    if constexpr (std::is_same_v<T, std::string>)
+        return element == make<T>(value);
+    else if constexpr (std::is_arithmetic_v<T>)
+        return element == static_cast<T>(value);
+    else
+        return element == value;
+}
+
+template <class T>
+void test_contiguous() {
+    for (int size = 0; size != 70; ++size) {
+        for (int n = 0; n <= size + 1; ++n) {
+            std::vector<T> left;
+            std::vector<T> right;
+            for (int i = 0; i != size; ++i) {
+                left.push_back(make<T>(i));
+                right.push_back(make<T>(i));
+            }
+
+            auto shifted_left = xranges::shift_left(left, n);
+            auto shifted_right = xranges::shift_right(right, n);
+            int const kept = n < size ? size - n : 0;
+            if (n == 0) {
+                assert(shifted_left.size() == left.size());
+                assert(shifted_right.size() == right.size());
+                continue;
+            }
+            assert(shifted_left.begin() == left.begin());
+            assert(shifted_left.size() == static_cast<std::size_t>(kept));
+            assert(shifted_right.end() == right.end());
+            assert(shifted_right.size() == static_cast<std::size_t>(kept));
+            for (int i = 0; i != kept; ++i) {
+                assert(holds(left[i], i + n));
+                assert(holds(right[i + n], i));
+            }
+
+            // The elements left behind can still be assigned and destroyed.
+            for (auto& element : left)
+                element = make<T>(-1);
+            for (auto& element : right)
+                element = make<T>(-1);
+        }
+    }
+}
+
+template <class It>
+void test_assignment_bound() {
+    for (int size = 0; size != 20; ++size) {
+        for (int n = 1; n <= size; ++n) {
+            std::vector<assignment_counted> values(size);
+            for (int i = 0; i != size; ++i)
+                values[i].value = i;
+
+            assignment_counted::assignments = 0;
+            xranges::shift_left(It(values.data()), It(values.data() + size), n);
+            assert(assignment_counted::assignments <= size - n);
+
+            assignment_counted::assignments = 0;
+            if constexpr (std::bidirectional_iterator<It>) {
+                xranges::shift_right(
+                    It(values.data()), It(values.data() + size), n);
+                assert(assignment_counted::assignments <= size - n);
+            }
+        }
+    }
+}
+
+// Bidirectional, non random access ranges shift right without buffering.
+void test_list() {
+    for (int size = 0; size != 20; ++size) {
+        for (int n = 1; n <= size + 1; ++n) {
+            std::list<assignment_counted> values;
+            for (int i = 0; i != size; ++i)
+                values.emplace_back(i);
+            assignment_counted::assignments = 0;
+            auto result = xranges::shift_right(values, n);
+            int const kept = n < size ? size - n : 0;
+            assert(assignment_counted::assignments <= kept);
+            assert(static_cast<int>(xranges::distance(result)) == kept);
+            int expected = 0;
+            for (auto const& element : result)
+                assert(element == expected++);
+        }
+    }
+}
+
+int main(int, char**) {
+    test_contiguous<char>();
+    test_contiguous<int>();
+    test_contiguous<std::uint64_t>();
+    test_contiguous<boxed>();
+    test_contiguous<std::string>();
+
+    test_assignment_bound<forward_iterator<assignment_counted*>>();
+    test_assignment_bound<bidirectional_iterator<assignment_counted*>>();
+    test_assignment_bound<random_access_iterator<assignment_counted*>>();
+    test_assignment_bound<contiguous_iterator<assignment_counted*>>();
+    test_list();
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,237 @@
+// Copyright 2025 Bryan Wong
+
+// Minimal micro-benchmark harness for the `*.bench.cpp` category.
+//
+// Every measurement is emitted as one JSON object per line on stdout so the
+// `bench` target can concatenate the output of all benchmark executables into
+// a single machine readable report. A short human readable summary is written
+// to stderr.
+//
+// Environment variables:
+//   RXX_BENCH_MIN_TIME_MS  minimum duration of one sample (default 20)
+//   RXX_BENCH_SAMPLES      number of samples per benchmark (default 11)
+//   RXX_BENCH_FILTER       only run benchmarks whose group contains this string
+//   RXX_BENCH_REVISION     revision identifier recorded with every result
+
+#pragma once
+
+#include "rxx/config.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if RXX_COMPILER_MSVC
+#  include <intrin.h>
+#endif
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+namespace tests {
+
+#if RXX_COMPILER_MSVC
+namespace details {
+inline void use_char_pointer(char const volatile*) {}
+} // namespace details
+
+template <typename T>
+inline void do_not_optimize(T const& value) {
+    details::use_char_pointer(&reinterpret_cast<char const volatile&>(value));
+    _ReadWriteBarrier();
+}
+
+inline void clobber_memory() {
+    _ReadWriteBarrier();
+}
+#else
+template <typename T>
+inline void do_not_optimize(T const& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <typename T>
+inline void do_not_optimize(T& value) {
+#  if RXX_COMPILER_CLANG
+    asm volatile("" : "+r,m"(value) : : "memory");
+#  else
+    asm volatile("" : "+m,r"(value) : : "memory");
+#  endif
+}
+
+inline void clobber_memory() {
+    asm volatile("" : : : "memory");
+}
+#endif
+
+struct benchmark_result {
+    std::string group;
+    std::string implementation;
+    std::size_t iterations;
+    std::size_t items_per_iteration;
+    double median_ns;
+    double min_ns;
+    double max_ns;
+};
+
+class benchmark_suite {
+    using clock = std::chrono::steady_clock;
+
+public:
+    explicit benchmark_suite(char const* source)
+        : source_(trim_source(source))
+        , revision_(env_or("RXX_BENCH_REVISION", "unknown"))
+        , filter_(env_or("RXX_BENCH_FILTER", ""))
+        , min_sample_ns_(env_number("RXX_BENCH_MIN_TIME_MS", 20) * 1000000.0)
+        , samples_(static_cast<std::size_t>(
+              std::max(1.0, env_number("RXX_BENCH_SAMPLES", 11)))) {}
+
+    benchmark_suite(benchmark_suite const&) = delete;
+    benchmark_suite& operator=(benchmark_suite const&) = delete;
+
+    /**
+     * @brief Times `body` and records it under `group`/`implementation`
+     *
+     * `items` is the number of elements processed by a single invocation of
+     * `body`, it is used to normalise the result to a per-element cost.
+     * Returns nothing when `group` is filtered out.
+     */
+    template <typename F>
+    std::optional<benchmark_result> run(std::string_view group,
+        std::string_view implementation, std::size_t items, F&& body) {
+        if (!filter_.empty() && group.find(filter_) == group.npos)
+            return std::nullopt;
+
+        // Warm up caches and find an iteration count that makes one sample
+        // last at least `min_sample_ns_`.
+        std::size_t iterations = 1;
+        for (;;) {
+            double const elapsed = time_batch(body, iterations);
+            if (elapsed >= min_sample_ns_ || iterations >= (1u << 30))
+                break;
+            double const scale =
+                elapsed > 0 ? (min_sample_ns_ * 1.2) / elapsed : 16.0;
+            iterations = static_cast<std::size_t>(
+                iterations * std::clamp(scale, 2.0, 16.0));
+        }
+
+        std::vector<double> samples;
+        samples.reserve(samples_);
+        for (std::size_t i = 0; i != samples_; ++i)
+            samples.push_back(time_batch(body, iterations) / iterations);
+        std::ranges::sort(samples);
+
+        results_.push_back(benchmark_result{
+            .group = std::string(group),
+            .implementation = std::string(implementation),
+            .iterations = iterations,
+            .items_per_iteration = items,
+            .median_ns = samples[samples.size() / 2],
+            .min_ns = samples.front(),
+            .max_ns = samples.back(),
+        });
+
+        emit(results_.back());
+        return results_.back();
+    }
+
+    /**
+     * @brief Times an rxx construct against the matching `std::` one
+     */
+    template <typename Rxx, typename Std>
+    void compare(std::string_view group, std::size_t items, Rxx&& rxx_body,
+        Std&& std_body) {
+        auto const rxx_result = run(group, "rxx", items, rxx_body);
+        auto const std_result = run(group, "std", items, std_body);
+        if (rxx_result && std_result && std_result->median_ns > 0) {
+            std::fprintf(stderr, "%-48.*s rxx/std = %.3f\n",
+                static_cast<int>(group.size()), group.data(),
+                rxx_result->median_ns / std_result->median_ns);
+        }
+    }
+
+    std::vector<benchmark_result> const& results() const noexcept {
+        return results_;
+    }
+
+private:
+    template <typename F>
+    static double time_batch(F& body, std::size_t iterations) {
+        auto const start = clock::now();
+        for (std::size_t i = 0; i != iterations; ++i) {
+            body();
+            clobber_memory();
+        }
+        auto const stop = clock::now();
+        return std::chrono::duration<double, std::nano>(stop - start).count();
+    }
+
+    void emit(benchmark_result const& result) const {
+        double const items = static_cast<double>(
+            std::max<std::size_t>(1, result.items_per_iteration));
+        std::printf("{\"revision\":\"%s\",\"source\":\"%s\",\"group\":\"",
+            revision_.c_str(), source_.c_str());
+        print_escaped(result.group);
+        std::printf("\",\"implementation\":\"");
+        print_escaped(result.implementation);
+        std::printf("\",\"iterations\":%zu,\"items\":%zu,\"median_ns\":%.3f,"
+                    "\"min_ns\":%.3f,\"max_ns\":%.3f,\"ns_per_item\":%.4f}\n",
+            result.iterations, result.items_per_iteration, result.median_ns,
+            result.min_ns, result.max_ns, result.median_ns / items);
+        std::fflush(stdout);
+
+        std::fprintf(stderr, "%-48s %-6s %12.1f ns %10.3f ns/item\n",
+            result.group.c_str(), result.implementation.c_str(),
+            result.median_ns, result.median_ns / items);
+    }
+
+    static void print_escaped(std::string_view str) {
+        for (char c : str) {
+            if (c == '"' || c == '\\')
+                std::putchar('\\');
+            std::putchar(c);
+        }
+    }
+
+    static std::string trim_source(char const* source) {
+        // Report the path relative to the test root, i.e. starting at the
+        // last `rxx/`, `gcc/` or `llvm/` component.
+        std::string_view view(source);
+        std::size_t start = 0;
+        for (std::string_view root : {"/rxx/", "/gcc/", "/llvm/"}) {
+            if (auto pos = view.rfind(root); pos != view.npos)
+                start = std::max(start, pos + 1);
+        }
+        return std::string(view.substr(start));
+    }
+
+    static std::string env_or(char const* name, char const* fallback) {
+        char const* value = std::getenv(name);
+        return value && *value ? value : fallback;
+    }
+
+    static double env_number(char const* name, double fallback) {
+        char const* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        char* end = nullptr;
+        double const result = std::strtod(value, &end);
+        return end != value && result > 0 ? result : fallback;
+    }
+
+    std::string source_;
+    std::string revision_;
+    std::string filter_;
+    double min_sample_ns_;
+    std::size_t samples_;
+    std::vector<benchmark_result> results_;
+};
+
+} // namespace tests
+RXX_DEFAULT_NAMESPACE_END
@@ -0,0 +1,220 @@
+// Copyright 2025 Bryan Wong
+
+// Global allocation counting for tests and benchmarks.
+//
+// Including this header replaces the global allocation and deallocation
+// functions with ones that count every call before forwarding to malloc/free.
+// It must therefore be included by exactly one translation unit of an
+// executable, which is always the case for a `*.pass.cpp` or `*.bench.cpp`.
+
+#pragma once
+
+#include "rxx/config.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+namespace tests {
+
+struct allocation_counts {
+    std::size_t allocations;
+    std::size_t deallocations;
+    std::size_t bytes;
+};
+
+class global_allocations {
+public:
+    static allocation_counts snapshot() noexcept {
+        return {allocations_.load(std::memory_order_relaxed),
+            deallocations_.load(std::memory_order_relaxed),
+            bytes_.load(std::memory_order_relaxed)};
+    }
+
+    static void record_allocation(std::size_t size) noexcept {
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        bytes_.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    static void record_deallocation() noexcept {
+        deallocations_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    static inline std::atomic<std::size_t> allocations_{0};
+    static inline std::atomic<std::size_t> deallocations_{0};
+    static inline std::atomic<std::size_t> bytes_{0};
+};
+
+/**
+ * @brief Counts the allocations made by any thread during its lifetime
+ */
+class allocation_scope {
+public:
+    allocation_scope() noexcept : start_(global_allocations::snapshot()) {}
+    allocation_scope(allocation_scope const&) = delete;
+    allocation_scope& operator=(allocation_scope const&) = delete;
+
+    std::size_t allocations() const noexcept {
+        return global_allocations::snapshot().allocations - start_.allocations;
+    }
+
+    std::size_t deallocations() const noexcept {
+        return global_allocations::snapshot().deallocations -
+            start_.deallocations;
+    }
+
+    std::size_t bytes() const noexcept {
+        return global_allocations::snapshot().bytes - start_.bytes;
+    }
+
+private:
+    allocation_counts start_;
+};
+
+template <typename F>
+void assert_no_allocations(F&& func) {
+    allocation_scope scope;
+    static_cast<F&&>(func)();
+    assert(scope.allocations() == 0);
+    assert(scope.deallocations() == 0);
+}
+
+namespace details {
+inline void* counted_allocate(std::size_t size) noexcept {
+    global_allocations::record_allocation(size);
+    return std::malloc(size ? size : 1);
+}
+
+// Over-aligned blocks store the pointer returned by malloc right before the
+// aligned address.
+inline void* counted_allocate(
+    std::size_t size, std::align_val_t alignment) noexcept {
+    auto const align = static_cast<std::size_t>(alignment);
+    global_allocations::record_allocation(size);
+    void* const block = std::malloc(size + align + sizeof(void*));
+    if (!block)
+        return nullptr;
+    auto const address = reinterpret_cast<std::uintptr_t>(block) +
+        sizeof(void*) + align - 1;
+    void* const aligned = reinterpret_cast<void*>(address & ~(align - 1));
+    static_cast<void**>(aligned)[-1] = block;
+    return aligned;
+}
+
+inline void counted_deallocate(void* ptr) noexcept {
+    if (ptr) {
+        global_allocations::record_deallocation();
+        std::free(ptr);
+    }
+}
+
+inline void counted_deallocate(void* ptr, std::align_val_t) noexcept {
+    if (ptr) {
+        global_allocations::record_deallocation();
+        std::free(static_cast<void**>(ptr)[-1]);
+    }
+}
+
+template <typename... Args>
+void* counted_allocate_or_throw(std::size_t size, Args... args) {
+    void* const result = counted_allocate(size, args...);
+    if (!result) {
+        RXX_THROW(std::bad_alloc());
+    }
+    return result;
+}
+} // namespace details
+
+} // namespace tests
+RXX_DEFAULT_NAMESPACE_END
+
+void* operator new(std::size_t size) {
+    return __RXX tests::details::counted_allocate_or_throw(size);
+}
+
+void* operator new[](std::size_t size) {
+    return __RXX tests::details::counted_allocate_or_throw(size);
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept {
+    return __RXX tests::details::counted_allocate(size);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept {
+    return __RXX tests::details::counted_allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return __RXX tests::details::counted_allocate_or_throw(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return __RXX tests::details::counted_allocate_or_throw(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment,
+    std::nothrow_t const&) noexcept {
+    return __RXX tests::details::counted_allocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+    std::nothrow_t const&) noexcept {
+    return __RXX tests::details::counted_allocate(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept {
+    __RXX tests::details::counted_deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    __RXX tests::details::counted_deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    __RXX tests::details::counted_deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    __RXX tests::details::counted_deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::nothrow_t const&) noexcept {
+    __RXX tests::details::counted_deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept {
+    __RXX tests::details::counted_deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept {
+    __RXX tests::details::counted_deallocate(ptr, alignment);
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {
+    __RXX tests::details::counted_deallocate(ptr, alignment);
+}
+
+void operator delete(
+    void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    __RXX tests::details::counted_deallocate(ptr, alignment);
+}
+
+void operator delete[](
+    void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    __RXX tests::details::counted_deallocate(ptr, alignment);
+}
+
+void operator delete(
+    void* ptr, std::align_val_t alignment, std::nothrow_t const&) noexcept {
+    __RXX tests::details::counted_deallocate(ptr, alignment);
+}
+
+void operator delete[](
+    void* ptr, std::align_val_t alignment, std::nothrow_t const&) noexcept {
+    __RXX tests::details::counted_deallocate(ptr, alignment);
+}
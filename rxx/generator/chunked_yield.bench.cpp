@@ -0,0 +1,76 @@
+// Copyright 2025 Bryan Wong
+
+// Summing small scalars produced by a generator: one co_yield per element,
+// against batches yielded as spans and consumed either element by element or
+// a chunk at a time.
+
+#include "rxx/generator.h"
+
+#if RXX_SUPPORTS_GENERATOR && RXX_SUPPORTS_GENERATOR_CHUNKS
+#  include "../benchmark.h"
+#  include "rxx/ranges.h"
+
+#  include <algorithm>
+#  include <cstddef>
+#  include <span>
+#  include <string>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+template <typename... Ts>
+using xgenerator = __RXX generator<Ts...>;
+
+constexpr int count = 1 << 16;
+
+xgenerator<int> per_element() {
+    for (int i = 0; i != count; ++i)
+        co_yield i;
+}
+
+xgenerator<int> batched(int size) {
+    std::vector<int> buffer(static_cast<std::size_t>(size));
+    for (int first = 0; first < count; first += size) {
+        int const n = std::min(size, count - first);
+        for (int i = 0; i != n; ++i)
+            buffer[static_cast<std::size_t>(i)] = first + i;
+        co_yield xranges::elements_of(
+            std::span<int const>(buffer).first(static_cast<std::size_t>(n)));
+    }
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    suite.run("sum", "per_element", count, [] {
+        long long total = 0;
+        for (int value : per_element())
+            total += value;
+        xtests::do_not_optimize(total);
+    });
+
+    for (int size : {16, 256, 4096}) {
+        std::string const group = "sum/batch" + std::to_string(size);
+        suite.run(group, "elements", count, [size] {
+            long long total = 0;
+            for (int value : batched(size))
+                total += value;
+            xtests::do_not_optimize(total);
+        });
+        suite.run(group, "chunks", count, [size] {
+            long long total = 0;
+            auto generator = batched(size);
+            for (auto const chunk : generator.chunks()) {
+                for (int value : chunk)
+                    total += value;
+            }
+            xtests::do_not_optimize(total);
+        });
+    }
+}
+#else
+int main() {
+    return 0;
+}
+#endif
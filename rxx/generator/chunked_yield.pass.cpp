@@ -0,0 +1,192 @@
+// Copyright 2025 Bryan Wong
+
+// co_yield elements_of(contiguous-range)
+// generator::chunks()
+//
+// Yielding a contiguous sized range from a generator hands the whole batch to
+// the consumer at once: iterating its elements does not resume the coroutine.
+// `chunks()` consumes the generator batch by batch, as spans; an element
+// yielded on its own is a batch of one and an empty batch is skipped. The
+// per-element interface of the generator is unchanged.
+
+#include "rxx/generator.h"
+
+#if RXX_SUPPORTS_GENERATOR && RXX_SUPPORTS_GENERATOR_CHUNKS
+#  include "rxx/ranges.h"
+
+#  include <array>
+#  include <cassert>
+#  include <cstddef>
+#  include <list>
+#  include <span>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+
+template <typename... Ts>
+using xgenerator = __RXX generator<Ts...>;
+
+int resumptions = 0;
+
+// The buffer is refilled after every batch, so the consumer must be done
+// with a batch before the generator is resumed.
+xgenerator<int> batches(int count, int size) {
+    std::vector<int> buffer(static_cast<std::size_t>(size));
+    for (int batch = 0; batch != count; ++batch) {
+        for (int i = 0; i != size; ++i)
+            buffer[static_cast<std::size_t>(i)] = batch * size + i;
+        co_yield xranges::elements_of(std::span<int const>(buffer));
+        ++resumptions;
+    }
+}
+
+xgenerator<int> mixed() {
+    std::array<int, 4> buffer = {2, 3, 4, 0};
+    co_yield 1;
+    co_yield xranges::elements_of(std::span(buffer).first(3));
+    co_yield 5;
+    co_yield xranges::elements_of(std::span<int>());
+    buffer = {6, 7, 8, 9};
+    co_yield xranges::elements_of(buffer);
+}
+
+xgenerator<int> nested() {
+    co_yield 0;
+    co_yield xranges::elements_of(mixed());
+    co_yield 10;
+}
+
+// Non contiguous ranges are still yielded element by element.
+xgenerator<int> from_list() {
+    std::list<int> values = {1, 2, 3};
+    co_yield xranges::elements_of(values);
+}
+
+void test_elements() {
+    resumptions = 0;
+    std::vector<int> values;
+    for (int value : batches(3, 4))
+        values.push_back(value);
+    assert(values.size() == 12);
+    for (int i = 0; i != 12; ++i)
+        assert(values[static_cast<std::size_t>(i)] == i);
+    assert(resumptions == 3);
+
+    int expected = 1;
+    for (int value : mixed())
+        assert(value == expected++);
+    assert(expected == 10);
+
+    expected = 0;
+    for (int value : nested()) {
+        assert(value == expected);
+        expected = expected == 9 ? 10 : expected + 1;
+    }
+
+    expected = 1;
+    for (int value : from_list())
+        assert(value == expected++);
+}
+
+// Advancing through a batch does not run the generator.
+void test_no_resume_within_batch() {
+    resumptions = 0;
+    auto generator = batches(2, 100);
+    auto it = generator.begin();
+    for (int i = 0; i != 99; ++i, ++it) {
+        assert(*it == i);
+        assert(resumptions == 0);
+    }
+    ++it;
+    assert(*it == 100);
+    assert(resumptions == 1);
+}
+
+template <typename Chunks>
+std::vector<std::vector<int>> collect(Chunks&& chunks) {
+    std::vector<std::vector<int>> result;
+    for (auto const& chunk : chunks)
+        result.emplace_back(chunk.begin(), chunk.end());
+    return result;
+}
+
+void test_chunks() {
+    {
+        auto generator = batches(3, 4);
+        auto chunks = generator.chunks();
+        static_assert(
+            xranges::contiguous_range<xranges::range_reference_t<
+                decltype(chunks)>>);
+        static_assert(
+            xranges::sized_range<xranges::range_reference_t<decltype(chunks)>>);
+        auto const result = collect(chunks);
+        assert(result.size() == 3);
+        for (std::size_t batch = 0; batch != 3; ++batch) {
+            assert(result[batch].size() == 4);
+            for (std::size_t i = 0; i != 4; ++i)
+                assert(result[batch][i] == static_cast<int>(batch * 4 + i));
+        }
+    }
+
+    {
+        auto generator = mixed();
+        auto const result = collect(generator.chunks());
+        std::vector<std::vector<int>> const expected = {
+            {1}, {2, 3, 4}, {5}, {6, 7, 8, 9}};
+        assert(result == expected);
+    }
+
+    { // batches of nested generators come through as they are
+        auto generator = nested();
+        auto const result = collect(generator.chunks());
+        std::vector<std::vector<int>> const expected = {
+            {0}, {1}, {2, 3, 4}, {5}, {6, 7, 8, 9}, {10}};
+        assert(result == expected);
+    }
+
+    { // element-wise yields are batches of one
+        auto generator = from_list();
+        auto const result = collect(generator.chunks());
+        std::vector<std::vector<int>> const expected = {{1}, {2}, {3}};
+        assert(result == expected);
+    }
+}
+
+#  if RXX_WITH_EXCEPTIONS
+xgenerator<int> throwing() {
+    std::array<int, 3> buffer = {1, 2, 3};
+    co_yield xranges::elements_of(buffer);
+    throw 42;
+}
+
+void test_exceptions() {
+    auto generator = throwing();
+    auto it = generator.begin();
+    assert(*it == 1);
+    ++it;
+    ++it;
+    assert(*it == 3);
+    try {
+        ++it;
+        assert(false);
+    } catch (int value) {
+        assert(value == 42);
+    }
+}
+#  endif
+
+int main(int, char**) {
+    test_elements();
+    test_no_resume_within_batch();
+    test_chunks();
+#  if RXX_WITH_EXCEPTIONS
+    test_exceptions();
+#  endif
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
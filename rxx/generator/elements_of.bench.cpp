@@ -0,0 +1,106 @@
+// Copyright 2025 Bryan Wong
+
+// Cost per element of generators nested with `elements_of`. Elements yielded
+// at the bottom of a chain should cost the same at any depth. A recursive
+// in-order tree traversal, which creates one generator per node, is compared
+// with an explicit stack.
+
+#include "rxx/generator.h"
+
+#if RXX_SUPPORTS_GENERATOR
+#  include "../benchmark.h"
+#  include "rxx/ranges.h"
+
+#  include <cstddef>
+#  include <memory>
+#  include <string>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+template <typename... Ts>
+using xgenerator = __RXX generator<Ts...>;
+
+constexpr int count = 1 << 12;
+
+xgenerator<int> nested(int depth, int n) {
+    if (depth == 0) {
+        for (int i = 0; i != n; ++i)
+            co_yield i;
+    } else {
+        co_yield xranges::elements_of(nested(depth - 1, n));
+    }
+}
+
+struct node {
+    int value;
+    std::unique_ptr<node> left;
+    std::unique_ptr<node> right;
+};
+
+std::unique_ptr<node> make_tree(int first, int last) {
+    if (first == last)
+        return nullptr;
+    int const middle = first + (last - first) / 2;
+    return std::make_unique<node>(
+        middle, make_tree(first, middle), make_tree(middle + 1, last));
+}
+
+xgenerator<int> in_order(node const* root) {
+    if (root == nullptr)
+        co_return;
+    co_yield xranges::elements_of(in_order(root->left.get()));
+    co_yield root->value;
+    co_yield xranges::elements_of(in_order(root->right.get()));
+}
+
+void bench_depth(xtests::benchmark_suite& suite) {
+    for (int depth : {0, 1, 10, 100, 1000, 10000}) {
+        // The chain is built once, only the elements at the bottom are timed.
+        auto generator = nested(depth, 1 << 30);
+        auto it = generator.begin();
+        suite.run("depth/" + std::to_string(depth), "elements_of", count, [&] {
+            int total = 0;
+            for (int i = 0; i != count; ++i, ++it)
+                total += *it;
+            xtests::do_not_optimize(total);
+        });
+    }
+}
+
+void bench_tree(xtests::benchmark_suite& suite) {
+    auto const tree = make_tree(0, count);
+    suite.run("tree", "elements_of", count, [&] {
+        int total = 0;
+        for (int value : in_order(tree.get()))
+            total += value;
+        xtests::do_not_optimize(total);
+    });
+    suite.run("tree", "explicit_stack", count, [&] {
+        int total = 0;
+        std::vector<node const*> stack;
+        for (node const* current = tree.get();
+            current != nullptr || !stack.empty();) {
+            for (; current != nullptr; current = current->left.get())
+                stack.push_back(current);
+            current = stack.back();
+            stack.pop_back();
+            total += current->value;
+            current = current->right.get();
+        }
+        xtests::do_not_optimize(total);
+    });
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    bench_depth(suite);
+    bench_tree(suite);
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,139 @@
+// Copyright 2025 Bryan Wong
+
+// Resuming a generator nested in `elements_of` chains transfers control
+// straight to the innermost active generator and back, so that the stack
+// depth does not grow with the nesting depth. 10000 levels of recursion must
+// work with a default sized stack. The cost per element at each depth is
+// measured by elements_of.bench.cpp.
+
+#include "rxx/generator.h"
+
+#if RXX_SUPPORTS_GENERATOR
+#  include "rxx/ranges.h"
+
+#  include <cassert>
+#  include <cstdint>
+
+namespace xranges = __RXX ranges;
+
+template <typename... Ts>
+using xgenerator = __RXX generator<Ts...>;
+
+constexpr int deep = 10000;
+
+RXX_ATTRIBUTE(NOINLINE) std::uintptr_t stack_position() {
+    char volatile marker = 0;
+    return reinterpret_cast<std::uintptr_t>(&marker);
+}
+
+std::uintptr_t innermost_stack = 0;
+
+// Yields `count` elements from `depth` levels down.
+xgenerator<int> nested(int depth, int count) {
+    if (depth == 0) {
+        for (int i = 0; i != count; ++i) {
+            innermost_stack = stack_position();
+            co_yield i;
+        }
+    } else {
+        co_yield xranges::elements_of(nested(depth - 1, count));
+    }
+}
+
+// Yields its depth on the way down and on the way back up.
+xgenerator<int> bracketed(int depth) {
+    co_yield depth;
+    if (depth != deep)
+        co_yield xranges::elements_of(bracketed(depth + 1));
+    co_yield -depth;
+}
+
+void test_deep_recursion() {
+    long total = 0;
+    int expected = 0;
+    for (int value : nested(deep, 100)) {
+        assert(value == expected++);
+        total += value;
+    }
+    assert(total == 99 * 100 / 2);
+
+    // Finishing each level transfers straight back to its parent.
+    int next = 0;
+    bool down = true;
+    for (int value : bracketed(0)) {
+        if (down) {
+            assert(value == next);
+            if (next == deep)
+                down = false;
+            else
+                ++next;
+        } else {
+            assert(value == -next);
+            --next;
+        }
+    }
+    assert(next == -1);
+}
+
+// The innermost generator runs at the same stack position whatever the
+// depth: a resumption through every level would use one frame per level.
+// GCC only turns symmetric transfer into a tail call when optimising.
+#  if !RXX_COMPILER_GCC || defined(__OPTIMIZE__)
+#    define STACK_IS_FLAT 1
+#  else
+#    define STACK_IS_FLAT 0
+#  endif
+#  if STACK_IS_FLAT
+void test_stack_is_flat() {
+    auto const position_at = [](int depth) {
+        auto generator = nested(depth, 1);
+        auto it = generator.begin();
+        assert(*it == 0);
+        return innermost_stack;
+    };
+    std::uintptr_t const shallow = position_at(0);
+    std::uintptr_t const deepest = position_at(deep);
+    std::uintptr_t const distance =
+        shallow > deepest ? shallow - deepest : deepest - shallow;
+    assert(distance < 4096);
+}
+#  endif
+
+#  if RXX_WITH_EXCEPTIONS
+xgenerator<int> throwing(int depth) {
+    if (depth == 0) {
+        co_yield 1;
+        throw depth;
+    }
+    co_yield xranges::elements_of(throwing(depth - 1));
+}
+
+void test_deep_exception() {
+    auto generator = throwing(deep);
+    auto it = generator.begin();
+    assert(*it == 1);
+    try {
+        ++it;
+        assert(false);
+    } catch (int depth) {
+        assert(depth == 0);
+    }
+}
+#  endif
+
+int main(int, char**) {
+    test_deep_recursion();
+#  if STACK_IS_FLAT
+    test_stack_is_flat();
+#  endif
+#  if RXX_WITH_EXCEPTIONS
+    test_deep_exception();
+#  endif
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
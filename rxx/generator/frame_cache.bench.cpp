@@ -0,0 +1,68 @@
+// Copyright 2025 Bryan Wong
+
+// Creating many short lived generators, as a parser does per token. Frames
+// of generators with the default allocator come from the per-thread frame
+// cache; the other implementations allocate every frame through a memory
+// resource.
+
+#include "rxx/generator.h"
+
+#if RXX_SUPPORTS_GENERATOR && RXX_SUPPORTS_GENERATOR_FRAME_CACHE
+#  include "../benchmark.h"
+
+#  include <cstddef>
+#  include <cstdio>
+#  include <memory_resource>
+
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 12;
+
+__RXX generator<int> tokens(int n) {
+    for (int i = 0; i != n; ++i)
+        co_yield i;
+}
+
+__RXX pmr::generator<int> tokens(
+    std::allocator_arg_t, std::pmr::polymorphic_allocator<>, int n) {
+    for (int i = 0; i != n; ++i)
+        co_yield i;
+}
+
+template <typename Make>
+void parse(Make make) {
+    for (std::size_t i = 0; i != count; ++i) {
+        int total = 0;
+        for (int value : make())
+            total += value;
+        xtests::do_not_optimize(total);
+    }
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    __RXX reset_generator_frame_cache_statistics();
+    suite.run("short_lived", "frame_cache", count,
+        [] { parse([] { return tokens(4); }); });
+    auto const stats = __RXX generator_frame_cache_statistics();
+    std::fprintf(stderr, "frame cache: %zu hits, %zu misses, hit rate %.4f\n",
+        stats.hits, stats.misses, stats.hit_rate());
+
+    std::pmr::polymorphic_allocator<> const new_delete(
+        std::pmr::new_delete_resource());
+    suite.run("short_lived", "new_delete_resource", count, [&] {
+        parse([&] { return tokens(std::allocator_arg, new_delete, 4); });
+    });
+
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::polymorphic_allocator<> const pooled(&pool);
+    suite.run("short_lived", "unsynchronized_pool_resource", count, [&] {
+        parse([&] { return tokens(std::allocator_arg, pooled, 4); });
+    });
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,248 @@
+// Copyright 2025 Bryan Wong
+
+// struct generator_frame_cache_stats;
+// generator_frame_cache_stats generator_frame_cache_statistics() noexcept;
+// void reset_generator_frame_cache_statistics() noexcept;
+// void trim_generator_frame_cache() noexcept;
+//
+// Generators using the default allocator take their coroutine frames from a
+// per-thread cache of freed frames, bucketed by size, before calling
+// operator new. The statistics describe the cache of the calling thread.
+
+#include "rxx/generator.h"
+
+#if RXX_SUPPORTS_GENERATOR && RXX_SUPPORTS_GENERATOR_FRAME_CACHE
+#  include "../count_new.h"
+#  include "rxx/ranges.h"
+
+#  include <cassert>
+#  include <cstddef>
+#  include <memory_resource>
+#  include <thread>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+template <typename... Ts>
+using xgenerator = __RXX generator<Ts...>;
+
+xgenerator<int> iota(int count) {
+    for (int i = 0; i != count; ++i)
+        co_yield i;
+}
+
+// A frame in a larger size bucket than the one of iota.
+xgenerator<int> buffered(int count) {
+    int buffer[256] = {};
+    for (int i = 0; i != count; ++i) {
+        buffer[i % 256] = i;
+        co_yield buffer[i % 256];
+    }
+}
+
+// Too large to be worth caching.
+xgenerator<int> huge() {
+    char buffer[1 << 16] = {};
+    co_yield buffer[0];
+    co_yield buffer[sizeof(buffer) - 1];
+}
+
+xgenerator<int> nested(int depth) {
+    if (depth != 0)
+        co_yield xranges::elements_of(nested(depth - 1));
+    co_yield depth;
+}
+
+xgenerator<int> throwing() {
+    co_yield 1;
+    throw 42;
+}
+
+xgenerator<int, int, std::pmr::polymorphic_allocator<>> with_resource(
+    std::allocator_arg_t, std::pmr::polymorphic_allocator<>) {
+    co_yield 1;
+}
+
+int drain(auto&& generator) {
+    int total = 0;
+    for (int value : generator)
+        total += value;
+    return total;
+}
+
+void start_cold() {
+    __RXX trim_generator_frame_cache();
+    __RXX reset_generator_frame_cache_statistics();
+    auto const stats = __RXX generator_frame_cache_statistics();
+    assert(stats.hits == 0);
+    assert(stats.misses == 0);
+    assert(stats.cached_frames == 0);
+    assert(stats.cached_bytes == 0);
+}
+
+void test_hits() {
+    start_cold();
+    assert(drain(iota(10)) == 45);
+    auto stats = __RXX generator_frame_cache_statistics();
+    assert(stats.hits == 0);
+    assert(stats.misses == 1);
+    assert(stats.cached_frames == 1);
+    assert(stats.cached_bytes > 0);
+
+    // Once warm, creating generators does not touch the heap.
+    xtests::assert_no_allocations([] {
+        for (int i = 0; i != 1000; ++i)
+            assert(drain(iota(10)) == 45);
+    });
+    stats = __RXX generator_frame_cache_statistics();
+    assert(stats.hits == 1000);
+    assert(stats.misses == 1);
+    assert(stats.hit_rate() > 0.99);
+}
+
+void test_buckets() {
+    start_cold();
+    drain(iota(3));
+    drain(buffered(3));
+    assert(__RXX generator_frame_cache_statistics().misses == 2);
+    assert(__RXX generator_frame_cache_statistics().cached_frames == 2);
+    xtests::assert_no_allocations([] {
+        for (int i = 0; i != 100; ++i) {
+            assert(drain(buffered(300)) == 299 * 300 / 2);
+            assert(drain(iota(5)) == 10);
+        }
+    });
+    assert(__RXX generator_frame_cache_statistics().hits == 200);
+}
+
+void test_nested() {
+    start_cold();
+    // Every level of the recursion is alive at the same time.
+    assert(drain(nested(8)) == 36);
+    auto const stats = __RXX generator_frame_cache_statistics();
+    assert(stats.misses == 9);
+    assert(stats.cached_frames == 9);
+    xtests::assert_no_allocations([] {
+        for (int i = 0; i != 100; ++i)
+            assert(drain(nested(8)) == 36);
+    });
+}
+
+void test_bypass() {
+    start_cold();
+    // Frames above the largest bucket always come from operator new.
+    for (int i = 0; i != 3; ++i) {
+        xtests::allocation_scope scope;
+        drain(huge());
+        assert(scope.allocations() == 1);
+        assert(scope.deallocations() == 1);
+    }
+    // So do frames of generators given an allocator.
+    drain(with_resource(std::allocator_arg, {}));
+    auto const stats = __RXX generator_frame_cache_statistics();
+    assert(stats.hits == 0);
+    assert(stats.cached_frames == 0);
+}
+
+void test_exceptions() {
+#  if RXX_WITH_EXCEPTIONS
+    start_cold();
+    for (int i = 0; i != 10; ++i) {
+        try {
+            drain(throwing());
+            assert(false);
+        } catch (int value) {
+            assert(value == 42);
+        }
+    }
+    auto const stats = __RXX generator_frame_cache_statistics();
+    assert(stats.misses == 1);
+    assert(stats.hits == 9);
+#  endif
+}
+
+void test_bounded() {
+    start_cold();
+    {
+        std::vector<xgenerator<int>> alive;
+        for (int i = 0; i != 10000; ++i)
+            alive.push_back(iota(1));
+    }
+    // The cache keeps a bounded number of frames, the rest is freed.
+    auto const stats = __RXX generator_frame_cache_statistics();
+    assert(stats.cached_frames > 0);
+    assert(stats.cached_frames < 10000);
+}
+
+void test_trim() {
+    start_cold();
+    drain(nested(4));
+    std::size_t const cached = __RXX generator_frame_cache_statistics()
+                                   .cached_frames;
+    assert(cached == 5);
+    xtests::allocation_scope scope;
+    __RXX trim_generator_frame_cache();
+    assert(scope.deallocations() == cached);
+    auto const stats = __RXX generator_frame_cache_statistics();
+    assert(stats.cached_frames == 0);
+    assert(stats.cached_bytes == 0);
+    // Statistics survive a trim.
+    assert(stats.misses == 5);
+}
+
+void test_per_thread() {
+    start_cold();
+    drain(iota(3));
+    std::jthread([] {
+        // A new thread starts with an empty cache.
+        auto stats = __RXX generator_frame_cache_statistics();
+        assert(stats.hits == 0);
+        assert(stats.misses == 0);
+        assert(stats.cached_frames == 0);
+        drain(iota(3));
+        drain(iota(3));
+        stats = __RXX generator_frame_cache_statistics();
+        assert(stats.misses == 1);
+        assert(stats.hits == 1);
+    }).join();
+    auto const stats = __RXX generator_frame_cache_statistics();
+    assert(stats.misses == 1);
+    assert(stats.hits == 0);
+    assert(stats.cached_frames == 1);
+}
+
+// A generator destroyed on another thread returns its frame to the cache of
+// that thread.
+void test_cross_thread() {
+    start_cold();
+    auto generator = iota(3);
+    auto it = generator.begin();
+    assert(*it == 0);
+    std::jthread([generator = std::move(generator)]() mutable {
+        __RXX reset_generator_frame_cache_statistics();
+        { auto discard = std::move(generator); }
+        assert(__RXX generator_frame_cache_statistics().cached_frames == 1);
+        __RXX trim_generator_frame_cache();
+    }).join();
+    assert(__RXX generator_frame_cache_statistics().cached_frames == 0);
+}
+
+int main(int, char**) {
+    test_hits();
+    test_buckets();
+    test_nested();
+    test_bypass();
+    test_exceptions();
+    test_bounded();
+    test_trim();
+    test_per_thread();
+    test_cross_thread();
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
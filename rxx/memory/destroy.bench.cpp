@@ -0,0 +1,80 @@
+// Copyright 2025 Bryan Wong
+
+// Tearing down large buffers with destroy, against std::ranges::destroy.
+// Trivially destructible elements cost nothing; with an execution policy,
+// elements owning memory are destroyed in parallel.
+
+#include "rxx/memory.h"
+
+#include "../benchmark.h"
+#include "raw_storage.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 20;
+
+template <typename T>
+void bench_trivial(xtests::benchmark_suite& suite, std::string const& name) {
+    raw_storage<T> storage(count);
+    std::uninitialized_value_construct(storage.begin(), storage.end());
+    suite.compare(
+        name + "/destroy", count,
+        [&] {
+            auto end = xranges::destroy(storage);
+            xtests::do_not_optimize(end);
+        },
+        [&] {
+            auto end = std::ranges::destroy(storage);
+            xtests::do_not_optimize(end);
+        });
+    suite.compare(
+        name + "/destroy_n", count,
+        [&] {
+            auto end = xranges::destroy_n(storage.begin(), count);
+            xtests::do_not_optimize(end);
+        },
+        [&] {
+            auto end = std::ranges::destroy_n(storage.begin(), count);
+            xtests::do_not_optimize(end);
+        });
+}
+
+#if RXX_SUPPORTS_PARALLEL_DESTROY
+// Both sides rebuild the strings before destroying them, so the difference
+// between them is the cost of the teardown.
+template <typename Policy>
+void bench_parallel(xtests::benchmark_suite& suite, std::string const& name,
+    Policy const& policy) {
+    raw_storage<std::string> storage(count / 8);
+    auto construct = [&] {
+        std::uninitialized_fill(
+            storage.begin(), storage.end(), std::string(48, 's'));
+    };
+    suite.compare(
+        name + "/string", count / 8,
+        [&] {
+            construct();
+            xranges::destroy(policy, storage);
+        },
+        [&] {
+            construct();
+            std::ranges::destroy(storage);
+        });
+}
+#endif
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    bench_trivial<int>(suite, "int");
+    bench_trivial<record>(suite, "record");
+#if RXX_SUPPORTS_PARALLEL_DESTROY
+    bench_parallel(suite, "seq", __RXX execution::seq);
+    bench_parallel(suite, "par", __RXX execution::par);
+#endif
+}
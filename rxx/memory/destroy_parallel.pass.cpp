@@ -0,0 +1,128 @@
+// Copyright 2025 Bryan Wong
+
+// Execution policy overloads of destroy and destroy_n. Large random access
+// ranges are torn down in chunks on the thread pool, other ranges
+// sequentially; every element must be destroyed exactly once.
+
+#include "rxx/memory.h"
+
+#if RXX_SUPPORTS_PARALLEL_DESTROY
+#  include "raw_storage.h"
+#  include "rxx/ranges.h"
+
+#  include <atomic>
+#  include <cassert>
+#  include <cstddef>
+#  include <forward_list>
+#  include <memory>
+#  include <string>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xexecution = __RXX execution;
+
+constexpr std::size_t sizes[] = {0, 1, 2, 7, 64, 1000, 4097, 100003};
+
+// Marks its slot when destroyed; a slot marked twice is a double destroy.
+struct tracked {
+    std::atomic<int>* slot;
+
+    explicit tracked(std::atomic<int>* s) noexcept : slot(s) {}
+    ~tracked() { slot->fetch_add(1, std::memory_order_relaxed); }
+};
+
+template <typename Policy>
+void test_tracked(Policy const& policy) {
+    for (std::size_t size : sizes) {
+        std::vector<std::atomic<int>> slots(size);
+        raw_storage<tracked> storage(size);
+        auto construct = [&] {
+            for (std::size_t i = 0; i != size; ++i) {
+                slots[i].store(0);
+                std::construct_at(storage.begin() + i, &slots[i]);
+            }
+        };
+        auto check = [&] {
+            for (auto const& slot : slots)
+                assert(slot.load() == 1);
+        };
+
+        construct();
+        assert(xranges::destroy(policy, storage) == storage.end());
+        check();
+
+        construct();
+        assert(xranges::destroy(policy, storage.begin(), storage.end()) ==
+            storage.end());
+        check();
+
+        construct();
+        assert(xranges::destroy_n(policy, storage.begin(),
+                   static_cast<std::ptrdiff_t>(size)) == storage.end());
+        check();
+    }
+}
+
+// Destructors that free memory, the case parallel teardown is meant for.
+template <typename Policy>
+void test_strings(Policy const& policy) {
+    for (std::size_t size : sizes) {
+        raw_storage<std::string> storage(size);
+        for (std::size_t i = 0; i != size; ++i)
+            std::construct_at(storage.begin() + i, 32 + i % 64, 's');
+        assert(xranges::destroy(policy, storage) == storage.end());
+    }
+}
+
+template <typename Policy>
+void test_trivial(Policy const& policy) {
+    std::vector<int> values(100003);
+    assert(xranges::destroy(policy, values) == values.end());
+    assert(xranges::destroy_n(policy, values.begin(), 100003) == values.end());
+}
+
+// Non random access ranges are accepted and destroyed sequentially.
+template <typename Policy>
+void test_sequential_fallback(Policy const& policy) {
+    std::vector<std::atomic<int>> slots(5);
+    std::allocator<tracked> alloc;
+    std::forward_list<tracked*> nodes;
+    for (auto& slot : slots)
+        nodes.push_front(std::construct_at(alloc.allocate(1), &slot));
+    auto pointees = nodes | __RXX views::transform([](tracked* p) -> tracked& {
+        return *p;
+    });
+    xranges::destroy(policy, pointees);
+    for (auto const& slot : slots)
+        assert(slot.load() == 1);
+    for (tracked* node : nodes)
+        alloc.deallocate(node, 1);
+}
+
+template <typename Policy>
+void test_policy(Policy const& policy) {
+    test_tracked(policy);
+    test_strings(policy);
+    test_trivial(policy);
+    test_sequential_fallback(policy);
+}
+
+int main(int, char**) {
+    test_policy(xexecution::seq);
+    test_policy(xexecution::unseq);
+    test_policy(xexecution::par);
+    test_policy(xexecution::par_unseq);
+
+    for (std::size_t threads : {1, 2, 3, 8}) {
+        xexecution::thread_pool pool(threads);
+        test_policy(xexecution::par.on(pool));
+        test_policy(xexecution::par_unseq.on(pool));
+    }
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
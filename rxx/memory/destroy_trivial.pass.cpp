@@ -0,0 +1,141 @@
+// Copyright 2025 Bryan Wong
+
+// destroy and destroy_n do no work per element when the element type is
+// trivially destructible: the end of the range is computed in constant time
+// whenever the iterator allows it, and no element is ever accessed.
+
+#include "rxx/memory.h"
+
+#if RXX_SUPPORTS_TRIVIAL_DESTROY
+#  include "../../llvm/test_iterators.h"
+#  include "rxx/ranges.h"
+
+#  include <cassert>
+#  include <cstddef>
+#  include <memory>
+#  include <string>
+#  include <type_traits>
+
+namespace xranges = __RXX ranges;
+
+struct trivial {
+    int value;
+};
+static_assert(std::is_trivially_destructible_v<trivial>);
+
+template <class T, class It>
+constexpr void test_common(T* first, T* last) {
+    using counting_it = operation_counting_iterator<It>;
+
+    { // (iterator, iterator) returns the end without walking the range
+        IteratorOpCounts ops;
+        auto result = xranges::destroy(
+            counting_it(It(first), &ops), counting_it(It(last), &ops));
+        assert(base(base(result)) == last);
+        assert(ops.increments == 0);
+        assert(ops.equal_cmps == 0);
+    }
+
+    { // (range) overload
+        IteratorOpCounts ops;
+        auto range = xranges::subrange(
+            counting_it(It(first), &ops), counting_it(It(last), &ops));
+        auto result = xranges::destroy(range);
+        assert(base(base(result)) == last);
+        assert(ops.increments == 0);
+        assert(ops.equal_cmps == 0);
+    }
+}
+
+template <class T, class It>
+constexpr void test_sized(T* first, T* last) {
+    using counting_it = operation_counting_iterator<It>;
+    auto const n = last - first;
+
+    { // a sized sentinel is reached with a single jump
+        IteratorOpCounts ops;
+        auto result = xranges::destroy(counting_it(It(first), &ops),
+            sized_sentinel<counting_it>(counting_it(It(last))));
+        assert(base(base(result)) == last);
+        assert(ops.increments <= 1);
+        assert(ops.equal_cmps == 0);
+    }
+
+    { // destroy_n advances by n at once
+        IteratorOpCounts ops;
+        auto result = xranges::destroy_n(counting_it(It(first), &ops), n);
+        assert(base(base(result)) == last);
+        assert(ops.increments <= 1);
+        assert(ops.equal_cmps == 0);
+    }
+}
+
+template <class T>
+constexpr void test_type(T* first, T* last) {
+    test_common<T, forward_iterator<T*>>(first, last);
+    test_common<T, bidirectional_iterator<T*>>(first, last);
+    test_common<T, random_access_iterator<T*>>(first, last);
+    test_sized<T, random_access_iterator<T*>>(first, last);
+    test_sized<T, contiguous_iterator<T*>>(first, last);
+
+    // Plain pointers.
+    assert(xranges::destroy(first, last) == last);
+    assert(xranges::destroy_n(first, last - first) == last);
+    assert(xranges::destroy(first, first) == first);
+    assert(xranges::destroy_n(first, 0) == first);
+}
+
+constexpr bool test() {
+    {
+        int values[1000] = {};
+        test_type(values, values + 1000);
+    }
+    {
+        trivial values[64] = {};
+        test_type(values, values + 64);
+    }
+    {
+        int* values[8] = {};
+        test_type(values, values + 8);
+    }
+    return true;
+}
+
+// Without a sized sentinel, reaching the end of a non random access range
+// still takes one increment per element but no element is accessed.
+void test_forward_sentinel() {
+    int values[100] = {};
+    using It = forward_iterator<int*>;
+    using counting_it = operation_counting_iterator<It>;
+    IteratorOpCounts ops;
+    auto result = xranges::destroy(counting_it(It(values), &ops),
+        sentinel_wrapper<counting_it>(counting_it(It(values + 100))));
+    assert(base(base(result)) == values + 100);
+    assert(ops.increments <= 100);
+}
+
+// Non trivially destructible types are still destroyed one by one.
+void test_non_trivial() {
+    std::allocator<std::string> alloc;
+    std::string* const first = alloc.allocate(10);
+    std::string* const last = first + 10;
+    std::uninitialized_fill(first, last, std::string(64, 's'));
+    assert(xranges::destroy(first, last) == last);
+    std::uninitialized_fill(first, last, std::string(64, 's'));
+    assert(xranges::destroy_n(first, 10) == last);
+    alloc.deallocate(first, 10);
+}
+
+int main(int, char**) {
+    test();
+    static_assert(test());
+    test_forward_sentinel();
+    test_non_trivial();
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,98 @@
+// Copyright 2025 Bryan Wong
+
+// Filling and value constructing large buffers of trivial types with the
+// uninitialized memory algorithms, against std::ranges. Zero and byte-repeated
+// patterns can be stored with memset, wider patterns with vector stores.
+
+#include "rxx/memory.h"
+
+#include "../benchmark.h"
+#include "raw_storage.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+// Large enough to leave the caches, like the buffers of a big container.
+constexpr std::size_t bytes = 8 << 20;
+
+template <typename T>
+void bench_fill(
+    xtests::benchmark_suite& suite, std::string const& name, T const& value) {
+    raw_storage<T> out(bytes / sizeof(T));
+    std::size_t const size = bytes / sizeof(T);
+    suite.compare(
+        name + "/uninitialized_fill", size,
+        [&] {
+            auto end = xranges::uninitialized_fill(out, value);
+            xtests::do_not_optimize(end);
+        },
+        [&] {
+            auto end = std::ranges::uninitialized_fill(out, value);
+            xtests::do_not_optimize(end);
+        });
+    suite.compare(
+        name + "/uninitialized_fill_n", size,
+        [&] {
+            auto end = xranges::uninitialized_fill_n(out.begin(), size, value);
+            xtests::do_not_optimize(end);
+        },
+        [&] {
+            auto end =
+                std::ranges::uninitialized_fill_n(out.begin(), size, value);
+            xtests::do_not_optimize(end);
+        });
+}
+
+template <typename T>
+void bench_value_construct(
+    xtests::benchmark_suite& suite, std::string const& name) {
+    raw_storage<T> out(bytes / sizeof(T));
+    std::size_t const size = bytes / sizeof(T);
+    suite.compare(
+        name + "/uninitialized_value_construct", size,
+        [&] {
+            auto end = xranges::uninitialized_value_construct(out);
+            xtests::do_not_optimize(end);
+        },
+        [&] {
+            auto end = std::ranges::uninitialized_value_construct(out);
+            xtests::do_not_optimize(end);
+        });
+    suite.compare(
+        name + "/uninitialized_value_construct_n", size,
+        [&] {
+            auto end =
+                xranges::uninitialized_value_construct_n(out.begin(), size);
+            xtests::do_not_optimize(end);
+        },
+        [&] {
+            auto end =
+                std::ranges::uninitialized_value_construct_n(out.begin(), size);
+            xtests::do_not_optimize(end);
+        });
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    bench_fill<char>(suite, "char/zero", '\0');
+    bench_fill<char>(suite, "char/pattern", 'x');
+    bench_fill<std::uint32_t>(suite, "uint32/zero", 0);
+    bench_fill<std::uint32_t>(suite, "uint32/byte_repeated", 0x01010101);
+    bench_fill<std::uint32_t>(suite, "uint32/pattern", 0xdeadbeef);
+    bench_fill<std::uint64_t>(suite, "uint64/pattern", 0x0123456789abcdefu);
+    bench_fill<double>(suite, "double/one", 1.0);
+    bench_fill<record>(suite, "record/zero", record{});
+    bench_fill<record>(suite, "record/pattern", record{42, 7, {'r'}});
+
+    bench_value_construct<char>(suite, "char");
+    bench_value_construct<std::uint32_t>(suite, "uint32");
+    bench_value_construct<double>(suite, "double");
+    bench_value_construct<int*>(suite, "pointer");
+    bench_value_construct<record>(suite, "record");
+}
@@ -0,0 +1,37 @@
+// Copyright 2025 Bryan Wong
+
+// Uninitialized storage and element types shared by the uninitialized memory
+// algorithm tests and benchmarks.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+// Owns uninitialized storage for `size` objects of type T. Constructing and
+// destroying the objects is up to the user.
+template <typename T>
+class raw_storage {
+public:
+    explicit raw_storage(std::size_t size)
+        : data_(static_cast<T*>(::operator new(size * sizeof(T))))
+        , size_(size) {}
+    raw_storage(raw_storage const&) = delete;
+    raw_storage& operator=(raw_storage const&) = delete;
+    ~raw_storage() { ::operator delete(data_); }
+
+    T* begin() const { return data_; }
+    T* end() const { return data_ + size_; }
+
+private:
+    T* data_;
+    std::size_t size_;
+};
+
+// A trivially copyable aggregate larger than a vector register.
+struct record {
+    std::uint64_t key;
+    std::uint32_t flags;
+    char payload[20];
+};
@@ -0,0 +1,87 @@
+// Copyright 2025 Bryan Wong
+
+// Growing a buffer with the uninitialized memory algorithms, against the
+// std:: algorithms, for trivially copyable and non trivial element types.
+
+#include "rxx/memory.h"
+
+#include "../benchmark.h"
+#include "raw_storage.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 14;
+
+template <typename T>
+void bench_copy(xtests::benchmark_suite& suite, std::string const& name,
+    std::vector<T> const& source) {
+    raw_storage<T> out(source.size());
+    suite.compare(
+        name + "/uninitialized_copy", source.size(),
+        [&] {
+            auto result = xranges::uninitialized_copy(source, out);
+            xtests::do_not_optimize(result.out);
+            std::destroy(out.begin(), result.out);
+        },
+        [&] {
+            auto end = std::uninitialized_copy(
+                source.begin(), source.end(), out.begin());
+            xtests::do_not_optimize(end);
+            std::destroy(out.begin(), end);
+        });
+}
+
+#if RXX_SUPPORTS_UNINITIALIZED_RELOCATE
+// Moves the elements back and forth between two buffers, the way a vector
+// moves its elements when it grows.
+template <typename T>
+void bench_relocate(xtests::benchmark_suite& suite, std::string const& name,
+    std::vector<T> const& source) {
+    raw_storage<T> first(source.size());
+    raw_storage<T> second(source.size());
+    std::uninitialized_copy(source.begin(), source.end(), first.begin());
+    suite.compare(
+        name + "/relocate", source.size(),
+        [&] {
+            xranges::uninitialized_relocate(first, second);
+            xranges::uninitialized_relocate(second, first);
+        },
+        [&] {
+            std::uninitialized_move(
+                first.begin(), first.end(), second.begin());
+            std::destroy(first.begin(), first.end());
+            std::uninitialized_move(
+                second.begin(), second.end(), first.begin());
+            std::destroy(second.begin(), second.end());
+        });
+    std::destroy(first.begin(), first.end());
+}
+#endif
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    std::vector<int> ints(count);
+    std::vector<record> records(count);
+    std::vector<std::string> strings(count);
+    for (std::size_t i = 0; i != count; ++i) {
+        ints[i] = static_cast<int>(i);
+        records[i].key = i;
+        strings[i].assign(4 + i % 40, static_cast<char>('a' + i % 26));
+    }
+
+    bench_copy(suite, "int", ints);
+    bench_copy(suite, "record", records);
+    bench_copy(suite, "string", strings);
+#if RXX_SUPPORTS_UNINITIALIZED_RELOCATE
+    bench_relocate(suite, "int", ints);
+    bench_relocate(suite, "record", records);
+    bench_relocate(suite, "string", strings);
+#endif
+}
@@ -0,0 +1,159 @@
+// Copyright 2025 Bryan Wong
+
+// uninitialized_copy, uninitialized_copy_n, uninitialized_move and
+// uninitialized_move_n from a contiguous range of a trivially copyable type
+// into contiguous storage of the same type may be lowered to memcpy. These
+// tests cover every length around the vector widths, both the bounded input
+// and bounded output cases, and the calls that must keep constructing one
+// element at a time.
+
+#include "../../llvm/memory/buffer.h"
+#include "../../llvm/memory/counted.h"
+#include "rxx/memory.h"
+#include "rxx/ranges.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+
+constexpr int max_length = 70;
+
+struct pod {
+    std::uint32_t id;
+    std::uint16_t tag;
+    char name[6];
+
+    friend bool operator==(pod const&, pod const&) = default;
+};
+
+enum class state : std::uint8_t { idle, busy };
+
+template <class T>
+T make(int i) {
+    if constexpr (std::is_same_v<T, pod>)
+        return pod{static_cast<std::uint32_t>(i), 7, {'n', 'a', 'm', 'e'}};
+    else if constexpr (std::is_same_v<T, state>)
+        return i % 2 ? state::busy : state::idle;
+    else if constexpr (std::is_pointer_v<T>)
+        return reinterpret_cast<T>(static_cast<std::uintptr_t>(i) * 16);
+    else
+        return static_cast<T>(i);
+}
+
+template <class T>
+void test_type() {
+    std::vector<T> input;
+    for (int i = 0; i != max_length + 1; ++i)
+        input.push_back(make<T>(i));
+
+    for (int length = 0; length <= max_length; ++length) {
+        // The output is one element larger or smaller than the input, so both
+        // the input and the output bound the copy.
+        int const shorter = length > 0 ? length - 1 : 0;
+        for (int out_length : {length, length + 1, shorter}) {
+            int const copied = std::min(length, out_length);
+            Buffer<T, max_length + 2> storage;
+            T* const out = storage.begin() + 1; // unaligned for vectors
+
+            auto copy = xranges::uninitialized_copy(input.data(),
+                input.data() + length, out, out + out_length);
+            assert(copy.in == input.data() + copied);
+            assert(copy.out == out + copied);
+            for (int i = 0; i != copied; ++i)
+                assert(out[i] == input[i]);
+
+            auto move = xranges::uninitialized_move(input.data(),
+                input.data() + length, out, out + out_length);
+            assert(move.in == input.data() + copied);
+            assert(move.out == out + copied);
+            for (int i = 0; i != copied; ++i)
+                assert(out[i] == input[i]);
+
+            auto copy_n = xranges::uninitialized_copy_n(
+                input.data(), length, out, out + out_length);
+            assert(copy_n.in == input.data() + copied);
+            assert(copy_n.out == out + copied);
+
+            auto move_n = xranges::uninitialized_move_n(
+                input.data(), length, out, out + out_length);
+            assert(move_n.in == input.data() + copied);
+            assert(move_n.out == out + copied);
+            for (int i = 0; i != copied; ++i)
+                assert(out[i] == input[i]);
+        }
+    }
+
+    // Range overloads.
+    std::vector<T> const source(input.begin(), input.begin() + 33);
+    Buffer<T, 33> storage;
+    auto result = xranges::uninitialized_copy(source, storage);
+    assert(result.out == storage.end());
+    for (int i = 0; i != 33; ++i)
+        assert(storage.begin()[i] == source[i]);
+}
+
+// Non trivially copyable element types, mixed element types and non
+// contiguous inputs construct each element.
+void test_element_wise() {
+    {
+        Counted in[5] = {
+            Counted(1), Counted(2), Counted(3), Counted(4), Counted(5)};
+        Buffer<Counted, 5> out;
+        Counted::reset();
+        xranges::uninitialized_copy(in, out);
+        assert(Counted::total_copies == 5);
+        assert(Counted::current_objects == 5);
+        xranges::destroy(out);
+        Counted::reset();
+        xranges::uninitialized_move_n(in, 5, out.begin(), out.end());
+        assert(Counted::total_moves == 5);
+        assert(Counted::current_objects == 5);
+        xranges::destroy(out);
+    }
+    Counted::reset();
+
+    {
+        int const in[] = {1, -2, 3, -4};
+        Buffer<long long, 4> out;
+        xranges::uninitialized_copy(in, out);
+        assert(out.begin()[1] == -2);
+        assert(out.begin()[3] == -4);
+    }
+
+    {
+        std::deque<std::uint32_t> in = {1, 2, 3, 4, 5, 6, 7};
+        Buffer<std::uint32_t, 7> out;
+        xranges::uninitialized_copy(in, out);
+        for (int i = 0; i != 7; ++i)
+            assert(out.begin()[i] == in[i]);
+    }
+
+    {
+        std::string const in[] = {"a", "bb", std::string(100, 'c')};
+        Buffer<std::string, 3> out;
+        xranges::uninitialized_copy(in, out);
+        assert(out.begin()[2] == in[2]);
+        xranges::destroy(out);
+    }
+}
+
+int main(int, char**) {
+    test_type<char>();
+    test_type<std::uint8_t>();
+    test_type<int>();
+    test_type<std::uint64_t>();
+    test_type<double>();
+    test_type<int*>();
+    test_type<state>();
+    test_type<pod>();
+    test_element_wise();
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Copyright 2025 Bryan Wong
+
+// uninitialized_fill, uninitialized_fill_n, uninitialized_value_construct and
+// uninitialized_value_construct_n over contiguous storage of trivial types may
+// use memset for zero or byte-repeated patterns and vector stores for wider
+// values. These tests cover every length around the vector widths and the
+// values and types whose object representation is not what a memset of their
+// value would produce.
+
+#include "../../llvm/memory/buffer.h"
+#include "rxx/memory.h"
+#include "rxx/ranges.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace xranges = __RXX ranges;
+
+constexpr int max_length = 70;
+
+struct record {
+    std::uint64_t key;
+    std::uint32_t flags;
+    char name[12];
+
+    friend bool operator==(record const&, record const&) = default;
+};
+
+struct with_member_pointer {
+    int record::*field;
+};
+
+struct with_initializer {
+    int value = 42;
+};
+
+template <class T>
+bool same_bytes(T const& left, T const& right) {
+    return std::memcmp(&left, &right, sizeof(T)) == 0;
+}
+
+template <class T>
+void test_fill(T const value) {
+    for (int length = 0; length <= max_length; ++length) {
+        Buffer<T, max_length + 2> storage;
+        // Poison the storage so that skipped elements are noticed.
+        std::memset(storage.buffer, 0xa5, sizeof(storage.buffer));
+        T* const first = storage.begin() + 1; // unaligned for vectors
+        T* const last = first + length;
+
+        T* result = xranges::uninitialized_fill(first, last, value);
+        assert(result == last);
+        for (int i = 0; i != length; ++i)
+            assert(same_bytes(first[i], value));
+        // The elements around the range are untouched.
+        unsigned char poison[sizeof(T)];
+        std::memset(poison, 0xa5, sizeof(T));
+        assert(std::memcmp(storage.begin(), poison, sizeof(T)) == 0);
+        assert(std::memcmp(last, poison, sizeof(T)) == 0);
+
+        std::memset(storage.buffer, 0xa5, sizeof(storage.buffer));
+        result = xranges::uninitialized_fill_n(first, length, value);
+        assert(result == last);
+        for (int i = 0; i != length; ++i)
+            assert(same_bytes(first[i], value));
+        assert(std::memcmp(last, poison, sizeof(T)) == 0);
+    }
+
+    // Range overload.
+    Buffer<T, 33> storage;
+    auto result = xranges::uninitialized_fill(storage, value);
+    assert(result == storage.end());
+    for (T const& element : storage)
+        assert(same_bytes(element, value));
+}
+
+template <class T>
+void test_value_construct() {
+    T const expected{};
+    for (int length = 0; length <= max_length; ++length) {
+        Buffer<T, max_length + 2> storage;
+        std::memset(storage.buffer, 0xa5, sizeof(storage.buffer));
+        T* const first = storage.begin() + 1;
+        T* const last = first + length;
+
+        T* result = xranges::uninitialized_value_construct(first, last);
+        assert(result == last);
+        for (int i = 0; i != length; ++i)
+            assert(first[i] == expected);
+
+        std::memset(storage.buffer, 0xa5, sizeof(storage.buffer));
+        result = xranges::uninitialized_value_construct_n(first, length);
+        assert(result == last);
+        for (int i = 0; i != length; ++i)
+            assert(first[i] == expected);
+        unsigned char poison[sizeof(T)];
+        std::memset(poison, 0xa5, sizeof(T));
+        assert(std::memcmp(last, poison, sizeof(T)) == 0);
+    }
+}
+
+void test_fill_values() {
+    // Zero and byte-repeated patterns.
+    test_fill<char>('\0');
+    test_fill<char>('x');
+    test_fill<std::uint8_t>(0xff);
+    test_fill<std::uint16_t>(0);
+    test_fill<std::uint16_t>(0x4242);
+    test_fill<std::int32_t>(-1);
+    test_fill<std::uint64_t>(0);
+
+    // Patterns that are not a repeated byte.
+    test_fill<std::uint16_t>(0x1234);
+    test_fill<std::uint32_t>(0xdeadbeef);
+    test_fill<std::uint64_t>(0x0123456789abcdefu);
+    test_fill<float>(1.5f);
+    test_fill<double>(-0.0); // not all bits zero
+    test_fill<double>(std::numeric_limits<double>::infinity());
+    test_fill<int*>(nullptr);
+    test_fill<record>(record{7, 0, {'k', 'e', 'y'}});
+    test_fill<record>(record{});
+}
+
+void test_value_construct_types() {
+    test_value_construct<char>();
+    test_value_construct<std::uint32_t>();
+    test_value_construct<std::uint64_t>();
+    test_value_construct<double>();
+    test_value_construct<int*>();
+    test_value_construct<record>();
+
+    // A null pointer to member is not all bits zero on common ABIs.
+    {
+        Buffer<with_member_pointer, 9> storage;
+        std::memset(storage.buffer, 0xa5, sizeof(storage.buffer));
+        xranges::uninitialized_value_construct(storage);
+        for (auto const& element : storage)
+            assert(element.field == nullptr);
+    }
+
+    // Value initialization runs default member initializers.
+    {
+        Buffer<with_initializer, 9> storage;
+        xranges::uninitialized_value_construct_n(storage.begin(), 9);
+        for (auto const& element : storage)
+            assert(element.value == 42);
+    }
+
+    // Non trivial types are still constructed one by one.
+    {
+        Buffer<std::string, 9> storage;
+        xranges::uninitialized_value_construct(storage);
+        for (auto const& element : storage)
+            assert(element.empty());
+        xranges::destroy(storage);
+
+        xranges::uninitialized_fill(storage, std::string(40, 'f'));
+        for (auto const& element : storage)
+            assert(element == std::string(40, 'f'));
+        xranges::destroy(storage);
+    }
+}
+
+int main(int, char**) {
+    test_fill_values();
+    test_value_construct_types();
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+// Copyright 2025 Bryan Wong
+
+// template<input_iterator I, sentinel_for<I> S1,
+//          nothrow-forward-iterator O, nothrow-sentinel-for<O> S2>
+//   uninitialized_relocate_result<I, O>
+//     uninitialized_relocate(I ifirst, S1 ilast, O ofirst, S2 olast);
+// template<input_range IR, nothrow-forward-range OR>
+//   uninitialized_relocate_result<borrowed_iterator_t<IR>,
+//                                 borrowed_iterator_t<OR>>
+//     uninitialized_relocate(IR&& in_range, OR&& out_range);
+// template<input_iterator I, nothrow-forward-iterator O,
+//          nothrow-sentinel-for<O> S>
+//   uninitialized_relocate_n_result<I, O>
+//     uninitialized_relocate_n(I ifirst, iter_difference_t<I> n,
+//                              O ofirst, S olast);
+//
+// Moves each element into the uninitialized output and destroys the source
+// element, in one pass. Trivially relocatable types are copied as bytes,
+// without calling constructors or destructors. If a move constructor throws,
+// every object in both ranges has been destroyed when the exception leaves.
+
+#include "rxx/memory.h"
+
+#if RXX_SUPPORTS_UNINITIALIZED_RELOCATE && RXX_SUPPORTS_TRIVIALLY_RELOCATABLE
+#  include "../../llvm/memory/buffer.h"
+#  include "../../llvm/memory/counted.h"
+#  include "rxx/ranges.h"
+#  include "rxx/type_traits/is_trivially_relocatable.h"
+
+#  include <cassert>
+#  include <concepts>
+#  include <cstdint>
+#  include <string>
+#  include <type_traits>
+#  include <utility>
+
+namespace xranges = __RXX ranges;
+
+// Owns a heap allocated value and opts in as trivially relocatable; counts
+// its live objects so that a relocation by bytes and one by move and destroy
+// are indistinguishable to the test.
+class boxed {
+public:
+    static inline int live = 0;
+
+    explicit boxed(int value) : ptr_(new int(value)) { ++live; }
+    boxed(boxed&& other) noexcept : ptr_(std::exchange(other.ptr_, nullptr)) {
+        ++live;
+    }
+    ~boxed() {
+        delete ptr_;
+        --live;
+    }
+
+    int value() const { return *ptr_; }
+
+private:
+    int* ptr_;
+};
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+template <>
+struct is_trivially_relocatable<boxed> : std::true_type {};
+RXX_DEFAULT_NAMESPACE_END
+
+static_assert(std::same_as<xranges::uninitialized_relocate_result<int*, int*>,
+    xranges::in_out_result<int*, int*>>);
+static_assert(std::same_as<xranges::uninitialized_relocate_n_result<int*, int*>,
+    xranges::in_out_result<int*, int*>>);
+
+void test_non_relocatable() {
+    constexpr int N = 5;
+    {
+        Buffer<Counted, N> in;
+        for (int i = 0; i != N; ++i)
+            ::new (in.begin() + i) Counted(i + 1);
+        Buffer<Counted, N + 1> out;
+        Counted::reset();
+        Counted::current_objects = N;
+
+        auto result = xranges::uninitialized_relocate(
+            in.begin(), in.end(), out.begin(), out.end());
+        assert(result.in == in.end());
+        assert(result.out == out.begin() + N);
+        assert(Counted::total_moves == N);
+        assert(Counted::total_copies == 0);
+        assert(Counted::current_objects == N);
+        for (int i = 0; i != N; ++i)
+            assert(out.begin()[i].value == i + 1);
+        xranges::destroy(out.begin(), result.out);
+    }
+    Counted::reset();
+
+    { // the output bounds the relocation, the rest of the input is kept
+        Buffer<Counted, N> in;
+        for (int i = 0; i != N; ++i)
+            ::new (in.begin() + i) Counted(i + 1);
+        Buffer<Counted, 2> out;
+        auto result = xranges::uninitialized_relocate_n(
+            in.begin(), N, out.begin(), out.end());
+        assert(result.in == in.begin() + 2);
+        assert(result.out == out.end());
+        assert(Counted::current_objects == N);
+        assert(in.begin()[2].value == 3);
+        xranges::destroy(out);
+        xranges::destroy(in.begin() + 2, in.end());
+    }
+    Counted::reset();
+
+    { // range overload
+        Buffer<Counted, N> in;
+        for (int i = 0; i != N; ++i)
+            ::new (in.begin() + i) Counted(i + 1);
+        Buffer<Counted, N> out;
+        auto result = xranges::uninitialized_relocate(in, out);
+        assert(result.in == in.end());
+        assert(result.out == out.end());
+        assert(Counted::current_objects == N);
+        xranges::destroy(out);
+    }
+    Counted::reset();
+
+    {
+        Buffer<std::string, 3> in;
+        ::new (in.begin()) std::string("short");
+        ::new (in.begin() + 1) std::string(100, 'l');
+        ::new (in.begin() + 2) std::string();
+        Buffer<std::string, 3> out;
+        xranges::uninitialized_relocate_n(
+            in.begin(), 3, out.begin(), out.end());
+        assert(out.begin()[0] == "short");
+        assert(out.begin()[1] == std::string(100, 'l'));
+        assert(out.begin()[2].empty());
+        xranges::destroy(out);
+    }
+}
+
+void test_relocatable() {
+    static_assert(__RXX is_trivially_relocatable_v<boxed>);
+    for (int n = 0; n != 70; ++n) {
+        Buffer<boxed, 70> in;
+        for (int i = 0; i != n; ++i)
+            ::new (in.begin() + i) boxed(i);
+        Buffer<boxed, 71> out;
+        int const live = boxed::live;
+
+        auto result = xranges::uninitialized_relocate(
+            in.begin(), in.begin() + n, out.begin() + 1, out.end());
+        assert(result.in == in.begin() + n);
+        assert(result.out == out.begin() + 1 + n);
+        assert(boxed::live == live);
+        for (int i = 0; i != n; ++i)
+            assert(out.begin()[1 + i].value() == i);
+        xranges::destroy(out.begin() + 1, result.out);
+    }
+    assert(boxed::live == 0);
+
+    // Trivially copyable types relocate by bytes too.
+    std::uint64_t in[33];
+    for (int i = 0; i != 33; ++i)
+        in[i] = static_cast<std::uint64_t>(i) * 0x9e3779b97f4a7c15u;
+    Buffer<std::uint64_t, 33> out;
+    xranges::uninitialized_relocate_n(in, 33, out.begin(), out.end());
+    for (int i = 0; i != 33; ++i)
+        assert(out.begin()[i] == static_cast<std::uint64_t>(i) *
+                0x9e3779b97f4a7c15u);
+}
+
+void test_exception() {
+#  if RXX_WITH_EXCEPTIONS
+    constexpr int N = 5;
+    Buffer<Counted, N> in;
+    for (int i = 0; i != N; ++i)
+        ::new (in.begin() + i) Counted(i + 1);
+    Buffer<Counted, N> out;
+    Counted::reset();
+    Counted::current_objects = N;
+    Counted::throw_on = 3; // the fourth move throws
+
+    try {
+        xranges::uninitialized_relocate(in, out);
+        assert(false);
+    } catch (int) {
+    }
+    assert(Counted::current_objects == 0);
+    Counted::reset();
+#  endif
+}
+
+int main(int, char**) {
+    test_non_relocatable();
+    test_relocatable();
+    test_exception();
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,53 @@
+// Copyright 2025 Bryan Wong
+
+// An upstream memory resource that counts the blocks requested from it and
+// checks that every block is returned with the size and alignment it was
+// allocated with.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <map>
+#include <memory_resource>
+#include <utility>
+
+class counting_resource : public std::pmr::memory_resource {
+public:
+    counting_resource() noexcept = default;
+    counting_resource(counting_resource const&) = delete;
+    counting_resource& operator=(counting_resource const&) = delete;
+    ~counting_resource() { assert(blocks_.empty()); }
+
+    std::size_t allocations() const noexcept { return allocations_; }
+    std::size_t deallocations() const noexcept { return deallocations_; }
+    std::size_t outstanding() const noexcept { return blocks_.size(); }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        void* const block = std::pmr::new_delete_resource()->allocate(
+            bytes, alignment);
+        blocks_.emplace(block, std::pair(bytes, alignment));
+        ++allocations_;
+        return block;
+    }
+
+    void do_deallocate(
+        void* block, std::size_t bytes, std::size_t alignment) override {
+        auto const it = blocks_.find(block);
+        assert(it != blocks_.end());
+        assert(it->second == std::pair(bytes, alignment));
+        blocks_.erase(it);
+        ++deallocations_;
+        std::pmr::new_delete_resource()->deallocate(block, bytes, alignment);
+    }
+
+    bool do_is_equal(
+        std::pmr::memory_resource const& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::map<void*, std::pair<std::size_t, std::size_t>> blocks_;
+    std::size_t allocations_ = 0;
+    std::size_t deallocations_ = 0;
+};
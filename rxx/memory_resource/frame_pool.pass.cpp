@@ -0,0 +1,189 @@
+// Copyright 2025 Bryan Wong
+
+// class unsynchronized_frame_pool : public std::pmr::memory_resource;
+//
+// A single threaded pool for the handful of block sizes coroutine frames
+// come in. Each size class keeps a freelist, so a frame freed is handed out
+// again to the next frame of the same class without going upstream. Blocks
+// larger than `largest_pooled_size()` go straight to the upstream resource.
+
+#include "rxx/config.h"
+
+#if RXX_SUPPORTS_MEMORY_RESOURCE
+#  include "rxx/memory_resource.h"
+
+#  include "counting_resource.h"
+#  include "rxx/generator.h"
+
+#  include <cassert>
+#  include <cstddef>
+#  include <cstdint>
+#  include <cstring>
+#  include <memory_resource>
+#  include <vector>
+
+namespace xpmr = __RXX pmr;
+
+static_assert(std::is_base_of_v<std::pmr::memory_resource,
+    xpmr::unsynchronized_frame_pool>);
+
+bool is_aligned(void* ptr, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+void test_alignment() {
+    counting_resource upstream;
+    xpmr::unsynchronized_frame_pool pool(&upstream);
+    for (std::size_t alignment = 1; alignment <= 256; alignment *= 2) {
+        for (std::size_t size : {1, 24, 100, 256, 1000}) {
+            void* const ptr = pool.allocate(size, alignment);
+            assert(is_aligned(ptr, alignment));
+            std::memset(ptr, 0xcd, size);
+            pool.deallocate(ptr, size, alignment);
+        }
+    }
+}
+
+void test_reuse() {
+    counting_resource upstream;
+    xpmr::unsynchronized_frame_pool pool(&upstream);
+    std::size_t const sizes[] = {64, 200, 512};
+    for (std::size_t size : sizes) {
+        void* const first = pool.allocate(size, alignof(std::max_align_t));
+        pool.deallocate(first, size, alignof(std::max_align_t));
+        void* const second = pool.allocate(size, alignof(std::max_align_t));
+        assert(second == first);
+        pool.deallocate(second, size, alignof(std::max_align_t));
+    }
+
+    // Freed blocks are handed out in LIFO order, the most recently used
+    // frame is the one most likely to be in cache.
+    void* a = pool.allocate(64, 16);
+    void* b = pool.allocate(64, 16);
+    assert(a != b);
+    pool.deallocate(a, 64, 16);
+    pool.deallocate(b, 64, 16);
+    assert(pool.allocate(64, 16) == b);
+    assert(pool.allocate(64, 16) == a);
+    pool.deallocate(a, 64, 16);
+    pool.deallocate(b, 64, 16);
+
+    // Steady state churn does not go upstream.
+    std::size_t const before = upstream.allocations();
+    for (int round = 0; round != 1000; ++round) {
+        void* frames[3];
+        for (int i = 0; i != 3; ++i)
+            frames[i] = pool.allocate(sizes[i], 16);
+        for (int i = 3; i-- != 0;)
+            pool.deallocate(frames[i], sizes[i], 16);
+    }
+    assert(upstream.allocations() == before);
+}
+
+void test_upstream_amortized() {
+    counting_resource upstream;
+    {
+        xpmr::unsynchronized_frame_pool pool(&upstream);
+        assert(pool.upstream_resource() == &upstream);
+        std::vector<void*> frames;
+        for (int i = 0; i != 4096; ++i)
+            frames.push_back(pool.allocate(96, 16));
+        // Blocks are carved out of larger chunks.
+        assert(upstream.allocations() <= 4096 / 8);
+        for (void* frame : frames)
+            pool.deallocate(frame, 96, 16);
+    }
+    assert(upstream.outstanding() == 0);
+}
+
+void test_large_blocks() {
+    counting_resource upstream;
+    xpmr::unsynchronized_frame_pool pool(&upstream);
+    std::size_t const large = pool.largest_pooled_size() + 1;
+    std::size_t const before = upstream.allocations();
+    void* const ptr = pool.allocate(large, 32);
+    assert(is_aligned(ptr, 32));
+    assert(upstream.allocations() == before + 1);
+    std::size_t const outstanding = upstream.outstanding();
+    pool.deallocate(ptr, large, 32);
+    assert(upstream.outstanding() == outstanding - 1);
+}
+
+void test_release() {
+    counting_resource upstream;
+    xpmr::unsynchronized_frame_pool pool(&upstream);
+    for (int i = 0; i != 100; ++i) {
+        (void)pool.allocate(128, 16);
+        (void)pool.allocate(pool.largest_pooled_size() * 2, 16);
+    }
+    pool.release();
+    assert(upstream.outstanding() == 0);
+    // The pool remains usable.
+    void* const ptr = pool.allocate(128, 16);
+    pool.deallocate(ptr, 128, 16);
+}
+
+void test_is_equal() {
+    xpmr::unsynchronized_frame_pool first;
+    xpmr::unsynchronized_frame_pool second;
+    assert(first.is_equal(first));
+    assert(!first.is_equal(second));
+    assert(first.upstream_resource() == std::pmr::get_default_resource());
+}
+
+#  if RXX_SUPPORTS_GENERATOR
+xpmr::generator<int> iota(
+    std::allocator_arg_t, std::pmr::polymorphic_allocator<>, int count) {
+    for (int i = 0; i != count; ++i)
+        co_yield i;
+}
+
+xpmr::generator<int> nested(
+    std::allocator_arg_t, std::pmr::polymorphic_allocator<> alloc, int depth) {
+    if (depth != 0)
+        co_yield __RXX ranges::elements_of(
+            nested(std::allocator_arg, alloc, depth - 1));
+    co_yield depth;
+}
+
+// Once warm, creating generators does not go upstream.
+void test_generator_frames() {
+    counting_resource upstream;
+    xpmr::unsynchronized_frame_pool pool(&upstream);
+    std::pmr::polymorphic_allocator<> const alloc(&pool);
+    auto run = [&] {
+        int total = 0;
+        for (int i : iota(std::allocator_arg, alloc, 10))
+            total += i;
+        assert(total == 45);
+        total = 0;
+        for (int i : nested(std::allocator_arg, alloc, 8))
+            total += i;
+        assert(total == 36);
+    };
+    run();
+    std::size_t const warm = upstream.allocations();
+    for (int round = 0; round != 1000; ++round)
+        run();
+    assert(upstream.allocations() == warm);
+}
+#  endif
+
+int main(int, char**) {
+    test_alignment();
+    test_reuse();
+    test_upstream_amortized();
+    test_large_blocks();
+    test_release();
+    test_is_equal();
+#  if RXX_SUPPORTS_GENERATOR
+    test_generator_frames();
+#  endif
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,115 @@
+// Copyright 2025 Bryan Wong
+
+// Cost of allocating coroutine frames from the rxx memory resources, against
+// new_delete_resource and the standard pool resource. The first group times
+// the resources alone with frame sized blocks, the second creates and drains
+// short generators, where the frame allocation is a large part of the cost.
+
+#include "rxx/config.h"
+
+#if RXX_SUPPORTS_MEMORY_RESOURCE
+#  include "rxx/memory_resource.h"
+
+#  include "../benchmark.h"
+#  include "rxx/generator.h"
+
+#  include <cstddef>
+#  include <memory_resource>
+#  include <string>
+
+namespace xpmr = __RXX pmr;
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 10;
+constexpr std::size_t frame_sizes[] = {96, 160, 320};
+
+// Allocates a batch of frames and frees them in reverse, like nested
+// generators being created and finished.
+void churn(std::pmr::memory_resource& resource) {
+    void* frames[count];
+    for (std::size_t i = 0; i != count; ++i) {
+        frames[i] = resource.allocate(frame_sizes[i % 3], 16);
+        xtests::do_not_optimize(frames[i]);
+    }
+    for (std::size_t i = count; i-- != 0;)
+        resource.deallocate(frames[i], frame_sizes[i % 3], 16);
+}
+
+void bench_resources(xtests::benchmark_suite& suite) {
+    suite.run("allocate", "new_delete_resource", count,
+        [] { churn(*std::pmr::new_delete_resource()); });
+
+    std::pmr::unsynchronized_pool_resource std_pool;
+    suite.run("allocate", "unsynchronized_pool_resource", count,
+        [&] { churn(std_pool); });
+
+    xpmr::unsynchronized_frame_pool frame_pool;
+    suite.run("allocate", "unsynchronized_frame_pool", count,
+        [&] { churn(frame_pool); });
+
+    auto& arena = xpmr::thread_arena();
+    suite.run("allocate", "thread_arena", count, [&] {
+        auto const mark = arena.mark();
+        churn(arena);
+        arena.release_to(mark);
+    });
+}
+
+#  if RXX_SUPPORTS_GENERATOR
+xpmr::generator<int> iota(
+    std::allocator_arg_t, std::pmr::polymorphic_allocator<>, int n) {
+    for (int i = 0; i != n; ++i)
+        co_yield i;
+}
+
+template <typename Before, typename After>
+void bench_generator(xtests::benchmark_suite& suite,
+    std::string const& implementation, std::pmr::memory_resource& resource,
+    Before before, After after) {
+    std::pmr::polymorphic_allocator<> const alloc(&resource);
+    suite.run("generator", implementation, count, [&] {
+        before();
+        for (std::size_t i = 0; i != count; ++i) {
+            int total = 0;
+            for (int value : iota(std::allocator_arg, alloc, 4))
+                total += value;
+            xtests::do_not_optimize(total);
+        }
+        after();
+    });
+}
+
+void bench_generators(xtests::benchmark_suite& suite) {
+    auto const nothing = [] {};
+    bench_generator(suite, "new_delete_resource",
+        *std::pmr::new_delete_resource(), nothing, nothing);
+
+    std::pmr::unsynchronized_pool_resource std_pool;
+    bench_generator(
+        suite, "unsynchronized_pool_resource", std_pool, nothing, nothing);
+
+    xpmr::unsynchronized_frame_pool frame_pool;
+    bench_generator(
+        suite, "unsynchronized_frame_pool", frame_pool, nothing, nothing);
+
+    auto& arena = xpmr::thread_arena();
+    auto mark = arena.mark();
+    bench_generator(
+        suite, "thread_arena", arena, [&] { mark = arena.mark(); },
+        [&] { arena.release_to(mark); });
+}
+#  endif
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    bench_resources(suite);
+#  if RXX_SUPPORTS_GENERATOR
+    bench_generators(suite);
+#  endif
+}
+#else
+int main() {
+    return 0;
+}
+#endif
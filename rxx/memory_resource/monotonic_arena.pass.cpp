@@ -0,0 +1,229 @@
+// Copyright 2025 Bryan Wong
+
+// class monotonic_arena : public std::pmr::memory_resource;
+// monotonic_arena& thread_arena() noexcept;
+//
+// A monotonic resource carving allocations out of upstream blocks with a
+// bump pointer. Deallocation is a no-op; memory is reclaimed with
+// `release_to(mark())`, which rewinds the bump pointer, or with `release()`,
+// which returns every upstream block. `thread_arena()` is an arena owned by
+// the calling thread.
+
+#include "rxx/config.h"
+
+#if RXX_SUPPORTS_MEMORY_RESOURCE
+#  include "rxx/memory_resource.h"
+
+#  include "counting_resource.h"
+#  include "rxx/generator.h"
+
+#  include <cassert>
+#  include <cstddef>
+#  include <cstdint>
+#  include <cstring>
+#  include <latch>
+#  include <memory_resource>
+#  include <thread>
+#  include <vector>
+
+namespace xpmr = __RXX pmr;
+
+static_assert(std::is_base_of_v<std::pmr::memory_resource,
+    xpmr::monotonic_arena>);
+
+bool is_aligned(void* ptr, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+void test_alignment() {
+    counting_resource upstream;
+    xpmr::monotonic_arena arena(1024, &upstream);
+    struct block {
+        unsigned char* ptr;
+        std::size_t size;
+    };
+    std::vector<block> blocks;
+    for (std::size_t i = 0; i != 500; ++i) {
+        std::size_t const size = 1 + i * 7 % 300;
+        std::size_t const alignment = std::size_t(1) << i % 8;
+        auto* const ptr =
+            static_cast<unsigned char*>(arena.allocate(size, alignment));
+        assert(is_aligned(ptr, alignment));
+        std::memset(ptr, static_cast<int>(i % 256), size);
+        blocks.push_back({ptr, size});
+    }
+    // No allocation overlaps another.
+    for (std::size_t i = 0; i != blocks.size(); ++i) {
+        for (std::size_t j = 0; j != blocks[i].size; ++j)
+            assert(blocks[i].ptr[j] == static_cast<unsigned char>(i % 256));
+    }
+}
+
+void test_bump_pointer() {
+    counting_resource upstream;
+    xpmr::monotonic_arena arena(4096, &upstream);
+    auto* const first = static_cast<std::byte*>(arena.allocate(16, 16));
+    auto* const second = static_cast<std::byte*>(arena.allocate(16, 16));
+    auto* const third = static_cast<std::byte*>(arena.allocate(32, 16));
+    assert(second == first + 16);
+    assert(third == second + 16);
+
+    // Deallocation does not make memory available again.
+    arena.deallocate(third, 32, 16);
+    assert(arena.allocate(32, 16) == third + 32);
+}
+
+void test_upstream_growth() {
+    counting_resource upstream;
+    {
+        xpmr::monotonic_arena arena(256, &upstream);
+        assert(arena.upstream_resource() == &upstream);
+        for (int i = 0; i != 10000; ++i)
+            (void)arena.allocate(64, 8);
+        // Blocks grow geometrically.
+        assert(upstream.allocations() <= 20);
+
+        // Allocations larger than a block are served too.
+        void* const large = arena.allocate(1 << 20, 64);
+        assert(is_aligned(large, 64));
+        std::memset(large, 0, 1 << 20);
+    }
+    assert(upstream.outstanding() == 0);
+}
+
+void test_initial_buffer() {
+    counting_resource upstream;
+    alignas(64) std::byte buffer[1024];
+    xpmr::monotonic_arena arena(buffer, sizeof(buffer), &upstream);
+    for (int i = 0; i != 16; ++i) {
+        auto* const ptr = static_cast<std::byte*>(arena.allocate(32, 8));
+        assert(ptr >= buffer && ptr + 32 <= buffer + sizeof(buffer));
+    }
+    assert(upstream.allocations() == 0);
+    (void)arena.allocate(1024, 8);
+    assert(upstream.allocations() == 1);
+    arena.release();
+    assert(upstream.outstanding() == 0);
+    // After release allocations start from the buffer again.
+    auto* const ptr = static_cast<std::byte*>(arena.allocate(32, 8));
+    assert(ptr >= buffer && ptr + 32 <= buffer + sizeof(buffer));
+}
+
+void test_release_to_mark() {
+    counting_resource upstream;
+    xpmr::monotonic_arena arena(512, &upstream);
+    (void)arena.allocate(100, 4);
+    auto const mark = arena.mark();
+    void* const after_mark = arena.allocate(48, 16);
+    for (int i = 0; i != 100; ++i)
+        (void)arena.allocate(64, 8);
+    std::size_t const blocks = upstream.allocations();
+    assert(blocks > 1);
+
+    arena.release_to(mark);
+    // The bump pointer is rewound to where it was.
+    assert(arena.allocate(48, 16) == after_mark);
+    // Blocks acquired after the mark are kept for reuse.
+    for (int i = 0; i != 100; ++i)
+        (void)arena.allocate(64, 8);
+    assert(upstream.allocations() == blocks);
+
+    // Marks nest.
+    auto const outer = arena.mark();
+    void* const p = arena.allocate(8, 8);
+    auto const inner = arena.mark();
+    (void)arena.allocate(8, 8);
+    arena.release_to(inner);
+    arena.release_to(outer);
+    assert(arena.allocate(8, 8) == p);
+
+    arena.release();
+    assert(upstream.outstanding() == 0);
+}
+
+void test_is_equal() {
+    xpmr::monotonic_arena first;
+    xpmr::monotonic_arena second;
+    assert(first.is_equal(first));
+    assert(!first.is_equal(second));
+    assert(first.upstream_resource() == std::pmr::get_default_resource());
+}
+
+void test_thread_arena() {
+    xpmr::monotonic_arena* const main_arena = &xpmr::thread_arena();
+    assert(&xpmr::thread_arena() == main_arena);
+
+    constexpr int threads = 4;
+    xpmr::monotonic_arena* arenas[threads] = {};
+    // Keeps every worker alive until all have taken their arena, a finished
+    // thread's storage could otherwise be reused by the next one.
+    std::latch all_started(threads);
+    {
+        std::vector<std::jthread> workers;
+        for (int t = 0; t != threads; ++t) {
+            workers.emplace_back([&arenas, &all_started, t] {
+                auto& arena = xpmr::thread_arena();
+                assert(&xpmr::thread_arena() == &arena);
+                arenas[t] = &arena;
+                all_started.arrive_and_wait();
+                // Used concurrently without synchronization.
+                auto const mark = arena.mark();
+                for (int i = 0; i != 1000; ++i) {
+                    auto* const ptr = static_cast<int*>(
+                        arena.allocate(sizeof(int), alignof(int)));
+                    *ptr = i;
+                }
+                arena.release_to(mark);
+            });
+        }
+    }
+    for (int t = 0; t != threads; ++t) {
+        assert(arenas[t] != main_arena);
+        for (int u = 0; u != t; ++u)
+            assert(arenas[t] != arenas[u]);
+    }
+}
+
+#  if RXX_SUPPORTS_GENERATOR
+xpmr::generator<int> iota(
+    std::allocator_arg_t, std::pmr::polymorphic_allocator<>, int count) {
+    for (int i = 0; i != count; ++i)
+        co_yield i;
+}
+
+// Generator frames can live in an arena.
+void test_generator_frames() {
+    counting_resource upstream;
+    xpmr::monotonic_arena arena(1 << 16, &upstream);
+    std::pmr::polymorphic_allocator<> const alloc(&arena);
+    auto const mark = arena.mark();
+    for (int round = 0; round != 1000; ++round) {
+        int total = 0;
+        for (int i : iota(std::allocator_arg, alloc, 10))
+            total += i;
+        assert(total == 45);
+        arena.release_to(mark);
+    }
+    assert(upstream.allocations() == 1);
+}
+#  endif
+
+int main(int, char**) {
+    test_alignment();
+    test_bump_pointer();
+    test_upstream_growth();
+    test_initial_buffer();
+    test_release_to_mark();
+    test_is_equal();
+    test_thread_arena();
+#  if RXX_SUPPORTS_GENERATOR
+    test_generator_frames();
+#  endif
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,65 @@
+// Copyright 2025 Bryan Wong
+
+// Monadic chains on optional must never touch the heap.
+
+#include "../count_new.h"
+#include "rxx/optional.h"
+
+#include <cassert>
+
+namespace xtests = __RXX tests;
+
+struct point {
+    int x;
+    int y;
+};
+
+__RXX optional<int> parse_digit(char c) {
+    if (c < '0' || c > '9')
+        return __RXX nullopt;
+    return c - '0';
+}
+
+void test_chains() {
+    xtests::assert_no_allocations([] {
+        auto result = parse_digit('7')
+                          .transform([](int value) { return value * 3; })
+                          .and_then([](int value) -> __RXX optional<long> {
+                              return value > 20 ? __RXX optional<long>(value)
+                                                : __RXX nullopt;
+                          })
+                          .or_else([] { return __RXX optional<long>(-1); });
+        assert(result.has_value());
+        assert(*result == 21);
+    });
+
+    xtests::assert_no_allocations([] {
+        auto result = parse_digit('x')
+                          .transform([](int value) { return value + 1; })
+                          .or_else([] { return __RXX optional<int>(0); })
+                          .transform([](int value) {
+                              return point{value, value};
+                          });
+        assert(result.has_value());
+        assert(result->x == 0 && result->y == 0);
+    });
+}
+
+void test_copies() {
+    __RXX optional<point> source = point{1, 2};
+
+    xtests::assert_no_allocations([&] {
+        __RXX optional<point> copy = source;
+        __RXX optional<point> empty;
+        empty = copy;
+        copy.reset();
+        copy.swap(empty);
+        assert(copy.has_value() && !empty.has_value());
+        assert(copy.value_or(point{0, 0}).y == 2);
+    });
+}
+
+int main() {
+    test_chains();
+    test_copies();
+}
@@ -0,0 +1,79 @@
+// Copyright 2025 Bryan Wong
+
+#include "rxx/optional.h"
+
+#include "../benchmark.h"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 14;
+
+template <typename Optional, typename Make>
+std::vector<Optional> make_data(Make make) {
+    std::vector<Optional> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i != count; ++i) {
+        if (i % 3 == 0)
+            result.emplace_back();
+        else
+            result.emplace_back(make(i));
+    }
+    return result;
+}
+
+template <typename Optional>
+void copy_construct(std::vector<Optional> const& source) {
+    std::vector<Optional> copy(source);
+    xtests::do_not_optimize(copy.data());
+}
+
+template <typename Optional>
+void copy_assign(
+    std::vector<Optional> const& source, std::vector<Optional>& target) {
+    for (std::size_t i = 0; i != source.size(); ++i)
+        target[i] = source[source.size() - 1 - i];
+    xtests::do_not_optimize(target.data());
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    {
+        auto make = [](std::size_t i) { return static_cast<int>(i); };
+        auto const rxx_data = make_data<__RXX optional<int>>(make);
+        auto const std_data = make_data<std::optional<int>>(make);
+        auto rxx_target = rxx_data;
+        auto std_target = std_data;
+
+        suite.compare(
+            "optional<int>/copy construct", count,
+            [&] { copy_construct(rxx_data); },
+            [&] { copy_construct(std_data); });
+        suite.compare(
+            "optional<int>/copy assign", count,
+            [&] { copy_assign(rxx_data, rxx_target); },
+            [&] { copy_assign(std_data, std_target); });
+    }
+
+    {
+        auto make = [](std::size_t i) { return std::string(i % 40, 'x'); };
+        auto const rxx_data = make_data<__RXX optional<std::string>>(make);
+        auto const std_data = make_data<std::optional<std::string>>(make);
+        auto rxx_target = rxx_data;
+        auto std_target = std_data;
+
+        suite.compare(
+            "optional<string>/copy construct", count,
+            [&] { copy_construct(rxx_data); },
+            [&] { copy_construct(std_data); });
+        suite.compare(
+            "optional<string>/copy assign", count,
+            [&] { copy_assign(rxx_data, rxx_target); },
+            [&] { copy_assign(std_data, std_target); });
+    }
+}
@@ -0,0 +1,89 @@
+// Copyright 2025 Bryan Wong
+
+// Iterating these views must never touch the heap.
+
+#include "../count_new.h"
+#include "rxx/ranges/chunk_by_view.h"
+#include "rxx/ranges/join_view.h"
+#include "rxx/ranges/zip_view.h"
+
+#include <array>
+#include <cassert>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+namespace xtests = __RXX tests;
+
+void test_zip() {
+    std::array<int, 6> a{1, 2, 3, 4, 5, 6};
+    std::vector<long> b{6, 5, 4, 3, 2, 1};
+    int const c[] = {1, 1, 1, 1};
+
+    xtests::assert_no_allocations([&] {
+        long total = 0;
+        for (auto&& [x, y] : xviews::zip(a, b))
+            total += x * y;
+        assert(total == 56);
+    });
+
+    xtests::assert_no_allocations([&] {
+        long total = 0;
+        for (auto&& [x, y, z] : xviews::zip(a, b, c))
+            total += x + y + z;
+        assert(total == 4 * 7 + 4);
+        auto zipped = xviews::zip(a, b);
+        assert(xranges::size(zipped) == 6);
+        auto [x, y] = zipped[5];
+        assert(x == 6 && y == 1);
+    });
+}
+
+void test_join() {
+    std::vector<std::vector<int>> ragged{{}, {1, 2}, {}, {3}, {4, 5, 6}, {}};
+    std::array<std::array<int, 2>, 3> fixed{
+        {{1, 2}, {3, 4}, {5, 6}}
+    };
+
+    xtests::assert_no_allocations([&] {
+        int total = 0;
+        for (int value : ragged | xviews::join)
+            total += value;
+        assert(total == 21);
+    });
+
+    xtests::assert_no_allocations([&] {
+        int total = 0;
+        auto joined = fixed | xviews::join;
+        for (auto it = joined.end(); it != joined.begin();)
+            total = total * 10 + *--it;
+        assert(total == 654321);
+    });
+}
+
+void test_chunk_by() {
+    int const values[] = {1, 2, 3, 2, 3, 4, 1, 1, 5};
+    std::vector<int> sizes_storage(8);
+
+    xtests::assert_no_allocations([&] {
+        auto chunks = values |
+            xviews::chunk_by([](int left, int right) { return left < right; });
+        std::size_t count = 0;
+        for (auto chunk : chunks)
+            sizes_storage[count++] = static_cast<int>(xranges::distance(chunk));
+        assert(count == 4);
+        assert(sizes_storage[0] == 3 && sizes_storage[1] == 3);
+        assert(sizes_storage[2] == 1 && sizes_storage[3] == 2);
+
+        std::size_t reverse_count = 0;
+        for (auto it = chunks.end(); it != chunks.begin(); --it)
+            ++reverse_count;
+        assert(reverse_count == count);
+    });
+}
+
+int main() {
+    test_zip();
+    test_join();
+    test_chunk_by();
+}
@@ -0,0 +1,80 @@
+// Copyright 2025 Bryan Wong
+
+// filter_single_pass_view against the caching filter_view in single pass
+// loops: a view built and iterated once per row of a table, and a chain of
+// filters where every stage would otherwise cache its begin().
+
+#include "rxx/ranges.h"
+
+#if RXX_SUPPORTS_FILTER_SINGLE_PASS
+#  include "rxx/ranges/filter_single_pass_view.h"
+
+#  include "../benchmark.h"
+
+#  include <cstddef>
+#  include <numeric>
+#  include <string>
+#  include <vector>
+
+namespace xviews = __RXX views;
+namespace xtests = __RXX tests;
+
+constexpr auto is_even = [](int i) { return i % 2 == 0; };
+constexpr auto not_multiple_of_3 = [](int i) { return i % 3 != 0; };
+constexpr auto not_multiple_of_5 = [](int i) { return i % 5 != 0; };
+constexpr auto squared = [](int i) { return i * i; };
+
+template <typename R>
+long long sum(R&& range) {
+    long long total = 0;
+    for (auto&& value : range)
+        total += value;
+    return total;
+}
+
+template <typename Rows, typename Filter>
+long long sum_rows(Rows const& rows, Filter filter) {
+    long long total = 0;
+    for (auto const& row : rows)
+        total += sum(row | filter(is_even) | xviews::transform(squared));
+    return total;
+}
+
+template <typename Filter>
+long long sum_chain(std::vector<int> const& values, Filter filter) {
+    return sum(values | filter(is_even) | filter(not_multiple_of_3) |
+        filter(not_multiple_of_5));
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    auto const caching = [](auto pred) { return xviews::filter(pred); };
+    auto const single_pass = [](auto pred) {
+        return xviews::filter_single_pass(pred);
+    };
+
+    for (std::size_t width : {4, 64}) {
+        std::vector<std::vector<int>> rows(
+            (1 << 16) / width, std::vector<int>(width));
+        for (auto& row : rows)
+            std::iota(row.begin(), row.end(), 0);
+        std::string const group = "rows/width" + std::to_string(width);
+        suite.run(group, "filter", rows.size() * width,
+            [&] { xtests::do_not_optimize(sum_rows(rows, caching)); });
+        suite.run(group, "filter_single_pass", rows.size() * width,
+            [&] { xtests::do_not_optimize(sum_rows(rows, single_pass)); });
+    }
+
+    std::vector<int> values(1 << 16);
+    std::iota(values.begin(), values.end(), 0);
+    suite.run("chain", "filter", values.size(),
+        [&] { xtests::do_not_optimize(sum_chain(values, caching)); });
+    suite.run("chain", "filter_single_pass", values.size(),
+        [&] { xtests::do_not_optimize(sum_chain(values, single_pass)); });
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,156 @@
+// Copyright 2025 Bryan Wong
+
+// template <view V, class Pred> class filter_single_pass_view;
+// views::filter_single_pass
+//
+// A filter_view that does not cache `begin()`: each call searches for the
+// first match again. In exchange the view is const-iterable, holds nothing
+// but its base and predicate, and is borrowed when its base is, the
+// iterators carrying the predicate themselves.
+
+#include "rxx/ranges.h"
+
+#if RXX_SUPPORTS_FILTER_SINGLE_PASS
+#  include "rxx/ranges/filter_single_pass_view.h"
+
+#  include "../../llvm/counting_predicates.h"
+#  include "../../llvm/test_iterators.h"
+#  include "rxx/algorithm.h"
+
+#  include <array>
+#  include <cassert>
+#  include <forward_list>
+#  include <list>
+#  include <utility>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+
+struct is_even {
+    constexpr bool operator()(int i) const { return i % 2 == 0; }
+};
+
+using vector_view = xranges::ref_view<std::vector<int>>;
+using span_filter = xranges::filter_single_pass_view<
+    xranges::subrange<int*>, is_even>;
+using vector_filter = xranges::filter_single_pass_view<vector_view, is_even>;
+using list_filter = xranges::filter_single_pass_view<
+    xranges::ref_view<std::forward_list<int>>, is_even>;
+
+static_assert(xranges::view<span_filter>);
+static_assert(xranges::bidirectional_range<span_filter>);
+static_assert(!xranges::random_access_range<span_filter>);
+static_assert(!xranges::sized_range<span_filter>);
+static_assert(xranges::common_range<span_filter>);
+static_assert(xranges::forward_range<list_filter>);
+static_assert(!xranges::bidirectional_range<list_filter>);
+
+// Const-iterable, unlike filter_view.
+static_assert(xranges::range<span_filter const>);
+static_assert(xranges::range<vector_filter const>);
+static_assert(
+    !xranges::range<xranges::filter_view<vector_view, is_even> const>);
+
+// Borrowed when the base is.
+static_assert(xranges::borrowed_range<span_filter>);
+static_assert(xranges::borrowed_range<vector_filter>);
+static_assert(!xranges::borrowed_range<xranges::filter_single_pass_view<
+        xranges::owning_view<std::vector<int>>, is_even>>);
+
+// No cached begin: smaller than filter_view.
+static_assert(sizeof(vector_filter) <
+    sizeof(xranges::filter_view<vector_view, is_even>));
+
+template <typename R>
+constexpr std::vector<int> collect(R&& range) {
+    std::vector<int> result;
+    for (int value : range)
+        result.push_back(value);
+    return result;
+}
+
+constexpr bool test_elements() {
+    int values[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    auto view = values | xviews::filter_single_pass(is_even{});
+    static_assert(std::same_as<decltype(view),
+        xranges::filter_single_pass_view<xranges::ref_view<int[8]>, is_even>>);
+    assert((collect(view) == std::vector<int>{2, 4, 6, 8}));
+    assert((collect(std::as_const(view)) == std::vector<int>{2, 4, 6, 8}));
+
+    // Walking back.
+    std::vector<int> reversed;
+    for (auto it = view.end(); it != view.begin();)
+        reversed.push_back(*--it);
+    assert((reversed == std::vector<int>{8, 6, 4, 2}));
+
+    // No match, empty base, everything matches.
+    int odd[] = {1, 3, 5};
+    assert(xranges::empty(odd | xviews::filter_single_pass(is_even{})));
+    assert(xranges::empty(
+        xranges::subrange<int*>(odd, odd) |
+        xviews::filter_single_pass(is_even{})));
+    int even[] = {2, 4};
+    assert(xranges::distance(even | xviews::filter_single_pass(is_even{})) ==
+        2);
+
+    // Composition with other adaptors.
+    auto pipeline = values | xviews::filter_single_pass(is_even{}) |
+        xviews::transform([](int i) { return i * 10; }) |
+        xviews::filter_single_pass([](int i) { return i > 30; });
+    assert((collect(pipeline) == std::vector<int>{40, 60, 80}));
+
+    return true;
+}
+
+void test_iterator_categories() {
+    int values[] = {1, 2, 3, 4, 5, 6};
+    using forward_range = xranges::subrange<forward_iterator<int*>>;
+    forward_range forward(forward_iterator<int*>(values),
+        forward_iterator<int*>(values + 6));
+    assert((collect(forward | xviews::filter_single_pass(is_even{})) ==
+        std::vector<int>{2, 4, 6}));
+
+    std::list<int> list(values, values + 6);
+    auto view = list | xviews::filter_single_pass(is_even{});
+    assert(*xranges::prev(view.end()) == 6);
+}
+
+// begin() is not cached, every call evaluates the predicate again up to the
+// first match.
+void test_begin_not_cached() {
+    int values[] = {1, 3, 5, 6, 7, 8};
+    int calls = 0;
+    auto view = values |
+        xviews::filter_single_pass(counting_predicate(is_even{}, calls));
+    assert(*view.begin() == 6);
+    assert(calls == 4);
+    assert(*view.begin() == 6);
+    assert(calls == 8);
+}
+
+// Iterators remain valid after the view is gone.
+void test_borrowed() {
+    std::vector<int> values = {1, 2, 3, 4, 5, 6};
+    auto it = xranges::find(
+        xranges::ref_view(values) | xviews::filter_single_pass(is_even{}), 4);
+    static_assert(!std::same_as<decltype(it), xranges::dangling>);
+    assert(*it == 4);
+    ++it;
+    assert(*it == 6);
+}
+
+int main(int, char**) {
+    test_elements();
+    static_assert(test_elements());
+    test_iterator_categories();
+    test_begin_not_cached();
+    test_borrowed();
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,103 @@
+// Copyright 2025 Bryan Wong
+
+// Pins the sizes of view iterators and sentinels for common pipelines.
+// Stateless functors take no space, and iterators of views whose functor is
+// empty and default constructible do not point back to their view. The
+// upper bounds always hold; the exact sizes are those of the compressed
+// layouts. Sizes are counted in base iterators and pointers, so that checked
+// iterators, larger than a pointer, change nothing.
+
+#include "rxx/ranges.h"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+
+using vector = std::vector<int>;
+
+constexpr std::size_t word = sizeof(void*);
+constexpr std::size_t base = sizeof(vector::iterator);
+static_assert(base >= word);
+
+constexpr auto twice = [](int i) { return i * 2; };
+constexpr auto plus_one = [](int i) { return i + 1; };
+constexpr auto is_even = [](int i) { return i % 2 == 0; };
+
+struct stateful {
+    int offset;
+    constexpr int operator()(int i) const { return i + offset; }
+};
+
+template <typename R>
+constexpr std::size_t iterator_size = sizeof(xranges::iterator_t<R>);
+template <typename R>
+constexpr std::size_t sentinel_size = sizeof(xranges::sentinel_t<R>);
+
+using transformed =
+    decltype(std::declval<vector&>() | xviews::transform(twice));
+using transformed_twice = decltype(std::declval<vector&>() |
+    xviews::transform(twice) | xviews::transform(plus_one));
+using transformed_stateful =
+    decltype(std::declval<vector&>() | xviews::transform(stateful{1}));
+using filtered = decltype(std::declval<vector&>() | xviews::filter(is_even));
+using filtered_transformed = decltype(std::declval<vector&>() |
+    xviews::filter(is_even) | xviews::transform(twice));
+using sandwich = decltype(std::declval<vector&>() | xviews::transform(twice) |
+    xviews::filter(is_even) | xviews::transform(plus_one));
+using zipped = decltype(xviews::zip(
+    std::declval<vector&>(), std::declval<vector&>()));
+using zipped3 = decltype(xviews::zip(std::declval<vector&>(),
+    std::declval<vector&>(), std::declval<vector&>()));
+using zip_transformed = decltype(xviews::zip_transform(
+    std::plus<>(), std::declval<vector&>(), std::declval<vector&>()));
+using taken = decltype(std::declval<vector&>() | xviews::filter(is_even) |
+    xviews::transform(twice) | xviews::take(3));
+
+// Upper bounds: a parent pointer per transform or filter level, or the end
+// of the base for a filter, never more.
+static_assert(iterator_size<transformed> <= base + word);
+static_assert(iterator_size<transformed_twice> <= base + 2 * word);
+static_assert(iterator_size<transformed_stateful> <= base + word);
+static_assert(iterator_size<filtered> <= 2 * base);
+static_assert(iterator_size<filtered_transformed> <= 2 * base + word);
+static_assert(iterator_size<sandwich> <= 2 * base + 2 * word);
+static_assert(iterator_size<zipped> <= 2 * base + word);
+static_assert(iterator_size<zipped3> <= 3 * base + word);
+static_assert(iterator_size<zip_transformed> <= 2 * base + 2 * word);
+static_assert(iterator_size<taken> <= 2 * base + 2 * word);
+
+#if RXX_SUPPORTS_COMPRESSED_VIEW_ITERATORS
+// A transform with a stateless functor is its base iterator.
+static_assert(iterator_size<transformed> == base);
+static_assert(iterator_size<transformed_twice> == base);
+static_assert(sentinel_size<transformed> == base);
+
+// A stateful functor is reached through the view.
+static_assert(iterator_size<transformed_stateful> == base + word);
+
+// A filter needs the end of its base to advance, and nothing else.
+static_assert(iterator_size<filtered> == 2 * base);
+static_assert(iterator_size<filtered_transformed> == 2 * base);
+static_assert(iterator_size<sandwich> == 2 * base);
+
+#  if RXX_SUPPORTS_INDEXED_ZIP
+// Over random access sized bases, a zip iterator is an index and a pointer
+// to each base.
+static_assert(iterator_size<zipped> == sizeof(std::ptrdiff_t) + 2 * word);
+static_assert(iterator_size<zipped3> == sizeof(std::ptrdiff_t) + 3 * word);
+#  else
+// The zip iterators hold the base iterators and nothing else.
+static_assert(iterator_size<zipped> == 2 * base);
+static_assert(iterator_size<zipped3> == 3 * base);
+#  endif
+// A stateless zip_transform functor adds nothing to the zip iterator.
+static_assert(iterator_size<zip_transformed> == iterator_size<zipped>);
+
+// take adds its count to the iterator below.
+static_assert(iterator_size<taken> ==
+    iterator_size<filtered_transformed> + sizeof(std::ptrdiff_t));
+#endif
@@ -0,0 +1,69 @@
+// Copyright 2025 Bryan Wong
+
+#include "rxx/ranges/join_view.h"
+
+#include "../benchmark.h"
+
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+namespace xviews = __RXX views;
+namespace xtests = __RXX tests;
+
+template <typename R>
+long long sum(R&& range) {
+    long long total = 0;
+    for (auto&& value : range)
+        total += value;
+    return total;
+}
+
+std::vector<std::vector<int>> make_uniform(
+    std::size_t outer, std::size_t inner) {
+    std::vector<std::vector<int>> result(outer, std::vector<int>(inner));
+    for (auto& row : result)
+        std::iota(row.begin(), row.end(), 0);
+    return result;
+}
+
+// Inner sizes cycle through 0..max_inner so that empty inner ranges have to
+// be skipped as well.
+std::vector<std::vector<int>> make_ragged(
+    std::size_t outer, std::size_t max_inner, std::size_t& total) {
+    std::vector<std::vector<int>> result(outer);
+    total = 0;
+    for (std::size_t i = 0; i != outer; ++i) {
+        result[i].resize(i % (max_inner + 1));
+        std::iota(result[i].begin(), result[i].end(), 0);
+        total += result[i].size();
+    }
+    return result;
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    {
+        auto const data = make_uniform(1024, 64);
+        suite.compare("join/uniform/1024x64", 1024 * 64,
+            [&] { xtests::do_not_optimize(sum(data | xviews::join)); },
+            [&] { xtests::do_not_optimize(sum(data | std::views::join)); });
+    }
+
+    {
+        auto const data = make_uniform(65536, 2);
+        suite.compare("join/uniform/65536x2", 65536 * 2,
+            [&] { xtests::do_not_optimize(sum(data | xviews::join)); },
+            [&] { xtests::do_not_optimize(sum(data | std::views::join)); });
+    }
+
+    {
+        std::size_t total = 0;
+        auto const data = make_ragged(8192, 31, total);
+        suite.compare("join/ragged/8192x[0,31]", total,
+            [&] { xtests::do_not_optimize(sum(data | xviews::join)); },
+            [&] { xtests::do_not_optimize(sum(data | std::views::join)); });
+    }
+}
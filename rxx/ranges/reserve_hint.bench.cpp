@@ -0,0 +1,58 @@
+// Copyright 2025 Bryan Wong
+
+// Collecting large filtered pipelines into a vector. rxx::ranges::to
+// reserves the hint of the pipeline up front, std::ranges::to grows the
+// vector geometrically because the pipeline is not sized.
+
+#include "rxx/ranges.h"
+
+#include "../benchmark.h"
+
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 20;
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), 0);
+
+    // Keeps one element in `ratio`.
+    for (int ratio : {1, 2, 16}) {
+        auto const keep = [ratio](int i) { return i % ratio == 0; };
+        suite.compare("filter/1_in_" + std::to_string(ratio), count,
+            [&] {
+                auto result =
+                    values | xviews::filter(keep) | xranges::to<std::vector>();
+                xtests::do_not_optimize(result.data());
+            },
+            [&] {
+                auto result = values | std::views::filter(keep) |
+                    std::ranges::to<std::vector>();
+                xtests::do_not_optimize(result.data());
+            });
+    }
+
+    auto const small = [](int i) { return i < static_cast<int>(count / 2); };
+    auto const twice = [](int i) { return i * 2; };
+    suite.compare("transform_take_while", count,
+        [&] {
+            auto result = values | xviews::transform(twice) |
+                xviews::take_while(small) | xranges::to<std::vector>();
+            xtests::do_not_optimize(result.data());
+        },
+        [&] {
+            auto result = values | std::views::transform(twice) |
+                std::views::take_while(small) | std::ranges::to<std::vector>();
+            xtests::do_not_optimize(result.data());
+        });
+}
@@ -0,0 +1,163 @@
+// Copyright 2025 Bryan Wong
+
+// ranges::reserve_hint(r)
+// template <class R> concept approximately_sized_range;
+//
+// reserve_hint gives the size of a sized range, or else the estimate a
+// range provides through a `reserve_hint()` member or an ADL found function.
+// Views that are not sized propagate the hint of their base: filter and
+// take_while its hint as an upper bound, take the smaller of its count and
+// that bound, transform it unchanged, join the sum of sized inner ranges.
+// ranges::to reserves the hint before inserting.
+
+#include "rxx/ranges.h"
+
+#if RXX_SUPPORTS_RESERVE_HINT
+#  include "../../llvm/test_iterators.h"
+#  include "../count_new.h"
+
+#  include <cassert>
+#  include <cstddef>
+#  include <forward_list>
+#  include <functional>
+#  include <sstream>
+#  include <string_view>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+namespace xtests = __RXX tests;
+
+// Three elements behind an iterator and sentinel that cannot be subtracted,
+// so that the range is not sized and only the hints below apply.
+struct unsized_elements {
+    int values[3] = {1, 2, 3};
+
+    constexpr forward_iterator<int const*> begin() const {
+        return forward_iterator<int const*>(values);
+    }
+    constexpr sentinel_wrapper<forward_iterator<int const*>> end() const {
+        return sentinel_wrapper(forward_iterator<int const*>(values + 3));
+    }
+};
+
+struct member_hint : unsized_elements {
+    constexpr std::size_t reserve_hint() const { return 42; }
+};
+
+namespace adl {
+struct free_hint : unsized_elements {};
+constexpr std::size_t reserve_hint(free_hint const&) {
+    return 7;
+}
+} // namespace adl
+
+static_assert(!xranges::sized_range<unsized_elements>);
+static_assert(!xranges::approximately_sized_range<unsized_elements>);
+static_assert(!xranges::sized_range<member_hint>);
+static_assert(!xranges::sized_range<adl::free_hint>);
+static_assert(xranges::approximately_sized_range<std::vector<int>>);
+static_assert(xranges::approximately_sized_range<member_hint>);
+static_assert(xranges::approximately_sized_range<adl::free_hint>);
+static_assert(!xranges::approximately_sized_range<std::forward_list<int>>);
+static_assert(
+    !xranges::approximately_sized_range<xranges::istream_view<int>>);
+
+constexpr auto is_even = [](int i) { return i % 2 == 0; };
+constexpr auto is_small = [](int i) { return i < 5; };
+
+template <typename R>
+constexpr bool is_upper_bound(R&& range) {
+    return static_cast<std::size_t>(xranges::distance(range)) <=
+        static_cast<std::size_t>(xranges::reserve_hint(range));
+}
+
+constexpr bool test_hints() {
+    int values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    assert(xranges::reserve_hint(values) == 10);
+    assert(xranges::reserve_hint(member_hint{}) == 42);
+    assert(is_upper_bound(member_hint{}));
+    assert(xranges::reserve_hint(adl::free_hint{}) == 7);
+    assert(is_upper_bound(adl::free_hint{}));
+
+    auto filtered = values | xviews::filter(is_even);
+    static_assert(!xranges::sized_range<decltype(filtered)>);
+    static_assert(xranges::approximately_sized_range<decltype(filtered)>);
+    assert(xranges::reserve_hint(filtered) == 10);
+    assert(is_upper_bound(filtered));
+
+    auto taken = filtered | xviews::take(3);
+    assert(xranges::reserve_hint(taken) == 3);
+    assert(xranges::reserve_hint(filtered | xviews::take(30)) == 10);
+
+    auto while_small = values | xviews::take_while(is_small);
+    assert(xranges::reserve_hint(while_small) == 10);
+    assert(is_upper_bound(while_small));
+
+    auto transformed = filtered | xviews::transform([](int i) { return -i; });
+    assert(xranges::reserve_hint(transformed) == 10);
+
+    // Hints compose through several adaptors.
+    auto pipeline = values | xviews::filter(is_even) |
+        xviews::transform([](int i) { return i * i; }) |
+        xviews::take_while([](int i) { return i < 50; }) | xviews::take(4);
+    assert(xranges::reserve_hint(pipeline) == 4);
+    assert(is_upper_bound(pipeline));
+
+    return true;
+}
+
+void test_join() {
+    std::vector<std::vector<int>> rows = {{1, 2}, {}, {3, 4, 5}};
+    auto joined = rows | xviews::join;
+    static_assert(xranges::approximately_sized_range<decltype(joined)>);
+    assert(xranges::reserve_hint(joined) == 5);
+
+    // Inner ranges that are not sized give no hint.
+    std::vector<std::forward_list<int>> lists = {{1}, {2, 3}};
+    static_assert(!xranges::approximately_sized_range<decltype(
+            lists | xviews::join)>);
+}
+
+// Splitting and chunking give an upper bound on the number of pieces.
+void test_pieces() {
+    std::string_view const text = "a,bc,,d";
+    auto pieces = text | xviews::lazy_split(',');
+    static_assert(xranges::approximately_sized_range<decltype(pieces)>);
+    assert(is_upper_bound(pieces));
+
+    int values[] = {1, 1, 2, 3, 3, 3, 4};
+    auto chunks = values | xviews::chunk_by(std::equal_to());
+    static_assert(xranges::approximately_sized_range<decltype(chunks)>);
+    assert(is_upper_bound(chunks));
+    assert(xranges::reserve_hint(chunks) <= 7);
+}
+
+// ranges::to reserves the hint, so the buffer is allocated only once.
+void test_to() {
+    std::vector<int> values(10000);
+    for (std::size_t i = 0; i != values.size(); ++i)
+        values[i] = static_cast<int>(i);
+
+    xtests::allocation_scope scope;
+    auto const evens =
+        values | xviews::filter(is_even) | xranges::to<std::vector>();
+    assert(scope.allocations() == 1);
+    assert(evens.size() == 5000);
+}
+
+int main(int, char**) {
+    test_hints();
+    static_assert(test_hints());
+    test_join();
+    test_pieces();
+    test_to();
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
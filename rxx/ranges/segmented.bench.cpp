@@ -0,0 +1,92 @@
+// Copyright 2025 Bryan Wong
+
+// Algorithms over joined ragged arrays. rxx algorithms recognise segmented
+// iterators and loop over each inner range on its own, std::ranges ones step
+// through the joined range one element at a time.
+
+#include "rxx/algorithm.h"
+#include "rxx/ranges/join_view.h"
+#include "rxx/ranges/join_with_view.h"
+
+#include "../benchmark.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+namespace xtests = __RXX tests;
+
+using ragged = std::vector<std::vector<int>>;
+
+// Inner sizes cycle through 0..max_inner, empty ones included.
+ragged make_ragged(std::size_t outer, std::size_t max_inner,
+    std::size_t& total) {
+    ragged result(outer);
+    total = 0;
+    for (std::size_t i = 0; i != outer; ++i) {
+        result[i].resize(i % (max_inner + 1));
+        std::iota(result[i].begin(), result[i].end(), 0);
+        total += result[i].size();
+    }
+    return result;
+}
+
+template <typename Rxx, typename Std>
+void bench_algorithms(xtests::benchmark_suite& suite, std::string const& name,
+    std::size_t total, Rxx const& rxx_view, Std const& std_view) {
+    suite.compare(name + "/fold_left", total,
+        [&] {
+            xtests::do_not_optimize(
+                xranges::fold_left(rxx_view, 0LL, std::plus()));
+        },
+        [&] {
+            xtests::do_not_optimize(
+                std::ranges::fold_left(std_view, 0LL, std::plus()));
+        });
+    suite.compare(name + "/contains", total,
+        [&] { xtests::do_not_optimize(xranges::contains(rxx_view, -1)); },
+        [&] { xtests::do_not_optimize(std::ranges::contains(std_view, -1)); });
+    suite.compare(name + "/find_last", total,
+        [&] { xtests::do_not_optimize(xranges::find_last(rxx_view, -1)); },
+        [&] {
+            xtests::do_not_optimize(std::ranges::find_last(std_view, -1));
+        });
+
+    std::vector<int> out(total);
+    suite.compare(name + "/copy", total,
+        [&] {
+            xtests::do_not_optimize(xranges::copy(rxx_view, out.begin()).out);
+        },
+        [&] {
+            xtests::do_not_optimize(
+                std::ranges::copy(std_view, out.begin()).out);
+        });
+    suite.compare(name + "/equal", total,
+        [&] { xtests::do_not_optimize(xranges::equal(rxx_view, out)); },
+        [&] { xtests::do_not_optimize(std::ranges::equal(std_view, out)); });
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    for (std::size_t max_inner : {3, 31, 255}) {
+        std::size_t total = 0;
+        auto const data = make_ragged((1 << 18) / (max_inner + 1) * 2,
+            max_inner, total);
+        std::string const shape = "[0," + std::to_string(max_inner) + "]";
+        bench_algorithms(suite, "join/ragged" + shape, total,
+            data | xviews::join, data | std::views::join);
+
+        std::vector<int> const pattern = {-2};
+        std::size_t const with_pattern = total + data.size() - 1;
+        bench_algorithms(suite, "join_with/ragged" + shape, with_pattern,
+            xviews::join_with(data, pattern),
+            std::views::join_with(data, pattern));
+    }
+}
@@ -0,0 +1,194 @@
+// Copyright 2025 Bryan Wong
+
+// template <class It> struct segmented_iterator_traits;
+// template <class It> concept segmented_iterator;
+//
+// The iterators of join_view, join_with_view and concat_view are segmented:
+// they decompose into an iterator over segments and a local iterator within
+// the current segment, so algorithms can run a tight loop per segment. The
+// results of the algorithms on ragged ranges, including empty segments, must
+// match those on the flattened range.
+
+#include "rxx/algorithm.h"
+#include "rxx/ranges/basic_istream_view.h"
+#include "rxx/ranges/concat_view.h"
+#include "rxx/ranges/join_view.h"
+#include "rxx/ranges/join_with_view.h"
+#include "rxx/ranges/transform_view.h"
+
+#if RXX_SUPPORTS_SEGMENTED_ITERATORS
+#  include "rxx/iterator/segmented_iterator.h"
+#endif
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+
+using ragged = std::vector<std::vector<int>>;
+
+ragged const shapes[] = {
+    {},
+    {{}},
+    {{}, {}, {}},
+    {{1}},
+    {{1, 2, 3}},
+    {{}, {1, 2}, {}, {}, {3}, {4, 5, 6, 7}, {}},
+    {{1, 2}, {3, 4}, {5, 6}, {7, 8}},
+};
+
+std::vector<int> flatten(ragged const& rows, std::vector<int> const& pattern) {
+    std::vector<int> result;
+    for (std::size_t i = 0; i != rows.size(); ++i) {
+        if (i != 0)
+            result.insert(result.end(), pattern.begin(), pattern.end());
+        result.insert(result.end(), rows[i].begin(), rows[i].end());
+    }
+    return result;
+}
+
+template <typename View>
+void test_algorithms(View&& view, std::vector<int> const& flat) {
+    assert(xranges::fold_left(view, 0, std::plus()) ==
+        xranges::fold_left(flat, 0, std::plus()));
+    assert(xranges::equal(view, flat));
+    std::vector<int> copied(flat.size());
+    auto const copy_result = xranges::copy(view, copied.begin());
+    assert(copy_result.out == copied.end());
+    assert(copied == flat);
+
+    for (int value = 0; value <= 9; ++value) {
+        bool const expected = xranges::contains(flat, value);
+        assert(xranges::contains(view, value) == expected);
+        auto const last = xranges::find_last(view, value);
+        auto const flat_last = xranges::find_last(flat, value);
+        assert(xranges::distance(xranges::begin(view), last.begin()) ==
+            flat_last.begin() - flat.begin());
+        assert(last.end() == xranges::end(view));
+    }
+
+    if (!flat.empty()) {
+        std::vector<int> different = flat;
+        different.back() += 100;
+        assert(!xranges::equal(view, different));
+        different.pop_back();
+        assert(!xranges::equal(view, different));
+    }
+}
+
+void test_join() {
+    for (auto const& rows : shapes)
+        test_algorithms(rows | xviews::join, flatten(rows, {}));
+}
+
+void test_join_with() {
+    std::vector<int> const patterns[] = {{}, {0}, {8, 9}};
+    for (auto const& rows : shapes) {
+        for (auto const& pattern : patterns) {
+            test_algorithms(xviews::join_with(rows, pattern),
+                flatten(rows, pattern));
+        }
+    }
+}
+
+void test_concat() {
+    for (auto const& rows : shapes) {
+        if (rows.size() < 3)
+            continue;
+        std::vector<int> flat = rows[0];
+        flat.insert(flat.end(), rows[1].begin(), rows[1].end());
+        flat.insert(flat.end(), rows[2].begin(), rows[2].end());
+        test_algorithms(xviews::concat(rows[0], rows[1], rows[2]), flat);
+    }
+}
+
+#if RXX_SUPPORTS_SEGMENTED_ITERATORS
+using join_iterator =
+    xranges::iterator_t<decltype(std::declval<ragged&>() | xviews::join)>;
+using join_with_iterator = xranges::iterator_t<decltype(xviews::join_with(
+    std::declval<ragged&>(), std::declval<std::vector<int>&>()))>;
+using concat_iterator = xranges::iterator_t<decltype(xviews::concat(
+    std::declval<std::vector<int>&>(), std::declval<std::vector<int>&>()))>;
+
+static_assert(__RXX segmented_iterator<join_iterator>);
+static_assert(__RXX segmented_iterator<join_with_iterator>);
+static_assert(__RXX segmented_iterator<concat_iterator>);
+static_assert(!__RXX segmented_iterator<std::vector<int>::iterator>);
+static_assert(!__RXX segmented_iterator<int*>);
+
+// A join over an input range cannot go back to a segment, so it is not
+// segmented.
+using input_join_iterator = xranges::iterator_t<decltype(
+    std::declval<xranges::istream_view<int>&>() |
+    xviews::transform([](int) { return std::vector<int>(); }) |
+    xviews::join)>;
+static_assert(!__RXX segmented_iterator<input_join_iterator>);
+
+// Every dereferenceable iterator decomposes into a segment and a local
+// iterator, and composing them gives the iterator back.
+template <typename View>
+void test_decompose(View&& view) {
+    using traits = __RXX segmented_iterator_traits<xranges::iterator_t<View>>;
+    for (auto it = xranges::begin(view); it != xranges::end(view); ++it) {
+        auto const segment = traits::segment(it);
+        auto const local = traits::local(it);
+        assert(&*local == &*it);
+        assert(local != traits::end(segment));
+        assert(traits::compose(segment, local) == it);
+    }
+}
+
+// Walking the segments visits every element once, in order.
+template <typename View>
+void test_walk(View&& view, std::vector<int> const& flat) {
+    using traits = __RXX segmented_iterator_traits<xranges::iterator_t<View>>;
+    if (flat.empty())
+        return;
+    std::vector<int> visited;
+    auto segment = traits::segment(xranges::begin(view));
+    auto const last = traits::segment(xranges::prev(xranges::end(view)));
+    for (;; ++segment) {
+        for (auto local = traits::begin(segment); local != traits::end(segment);
+            ++local)
+            visited.push_back(*local);
+        if (segment == last)
+            break;
+    }
+    assert(visited == flat);
+}
+
+void test_traits() {
+    std::vector<int> const pattern = {0};
+    for (auto const& shape : shapes) {
+        auto rows = shape;
+        auto joined = rows | xviews::join;
+        test_decompose(joined);
+        test_walk(joined, flatten(rows, {}));
+
+        std::vector<int> separator = pattern;
+        auto joined_with = xviews::join_with(rows, separator);
+        test_decompose(joined_with);
+        test_walk(joined_with, flatten(rows, pattern));
+    }
+
+    std::vector<int> a = {1, 2}, b, c = {3};
+    auto concatenated = xviews::concat(a, b, c);
+    test_decompose(concatenated);
+    test_walk(concatenated, {1, 2, 3});
+}
+#endif
+
+int main(int, char**) {
+    test_join();
+    test_join_with();
+    test_concat();
+#if RXX_SUPPORTS_SEGMENTED_ITERATORS
+    test_traits();
+#endif
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+// Copyright 2025 Bryan Wong
+
+// Materialising joined and concatenated ranges into a vector with
+// ranges::to, against std::ranges::to on the same pipelines.
+
+#include "rxx/ranges.h"
+#include "rxx/ranges/concat_view.h"
+#include "rxx/ranges/join_view.h"
+
+#include "../benchmark.h"
+
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+namespace xtests = __RXX tests;
+
+std::vector<std::vector<int>> make_rows(
+    std::size_t outer, std::size_t max_inner, std::size_t& total) {
+    std::vector<std::vector<int>> result(outer);
+    total = 0;
+    for (std::size_t i = 0; i != outer; ++i) {
+        result[i].resize(i % (max_inner + 1));
+        std::iota(result[i].begin(), result[i].end(), 0);
+        total += result[i].size();
+    }
+    return result;
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    for (std::size_t max_inner : {7, 63, 1023}) {
+        std::size_t total = 0;
+        auto const rows = make_rows((1 << 20) / (max_inner + 1) * 2,
+            max_inner, total);
+        suite.compare("join/[0," + std::to_string(max_inner) + "]", total,
+            [&] {
+                auto result = rows | xviews::join | xranges::to<std::vector>();
+                xtests::do_not_optimize(result.data());
+            },
+            [&] {
+                auto result = rows | std::views::join |
+                    std::ranges::to<std::vector>();
+                xtests::do_not_optimize(result.data());
+            });
+    }
+
+    // Without a standard concat_view, the reference is the hand written
+    // reserve and insert.
+    std::vector<int> a(1 << 18);
+    std::vector<int> b(1 << 16);
+    std::vector<int> c(1 << 17);
+    std::iota(a.begin(), a.end(), 0);
+    std::iota(b.begin(), b.end(), 0);
+    std::iota(c.begin(), c.end(), 0);
+    std::size_t const total = a.size() + b.size() + c.size();
+    suite.run("concat", "rxx", total, [&] {
+        auto result = xviews::concat(a, b, c) | xranges::to<std::vector>();
+        xtests::do_not_optimize(result.data());
+    });
+    suite.run("concat", "reserve_insert", total, [&] {
+        std::vector<int> result;
+        result.reserve(total);
+        result.insert(result.end(), a.begin(), a.end());
+        result.insert(result.end(), b.begin(), b.end());
+        result.insert(result.end(), c.begin(), c.end());
+        xtests::do_not_optimize(result.data());
+    });
+}
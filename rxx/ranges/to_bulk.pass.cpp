@@ -0,0 +1,160 @@
+// Copyright 2025 Bryan Wong
+
+// ranges::to computes the exact size of joined and concatenated ranges whose
+// parts are sized, reserves it once, then appends the parts one segment at a
+// time with `append_range` so that contiguous segments are bulk copies.
+
+#include "rxx/ranges.h"
+
+#if RXX_SUPPORTS_BULK_RANGES_TO
+#  include "../count_new.h"
+#  include "rxx/ranges/concat_view.h"
+#  include "rxx/ranges/join_view.h"
+
+#  include <array>
+#  include <cassert>
+#  include <cstddef>
+#  include <forward_list>
+#  include <string>
+#  include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+namespace xtests = __RXX tests;
+
+// Records how `to` fills it.
+template <typename T>
+class recording_container {
+public:
+    using value_type = T;
+
+    recording_container() = default;
+
+    auto begin() const { return elements_.begin(); }
+    auto end() const { return elements_.end(); }
+    std::size_t size() const { return elements_.size(); }
+    std::size_t capacity() const { return elements_.capacity(); }
+    std::size_t max_size() const { return elements_.max_size(); }
+
+    void reserve(std::size_t n) {
+        reserved.push_back(n);
+        elements_.reserve(n);
+    }
+
+    template <typename R>
+    void append_range(R&& range) {
+        appended.push_back(static_cast<std::size_t>(xranges::distance(range)));
+        all_contiguous = all_contiguous && xranges::contiguous_range<R>;
+        for (auto&& element : range)
+            elements_.push_back(element);
+    }
+
+    void push_back(T const& value) {
+        ++pushed;
+        elements_.push_back(value);
+    }
+
+    std::vector<T> const& elements() const { return elements_; }
+
+    std::vector<std::size_t> reserved;
+    std::vector<std::size_t> appended;
+    std::size_t pushed = 0;
+    bool all_contiguous = true;
+
+private:
+    std::vector<T> elements_;
+};
+
+void test_join_segments() {
+    std::vector<std::vector<int>> const rows = {
+        {1, 2}, {}, {3}, {4, 5, 6}, {}};
+    auto const result =
+        rows | xviews::join | xranges::to<recording_container<int>>();
+    assert((result.elements() == std::vector<int>{1, 2, 3, 4, 5, 6}));
+    assert((result.reserved == std::vector<std::size_t>{6}));
+    // Empty segments may be skipped.
+    std::vector<std::size_t> non_empty;
+    for (std::size_t n : result.appended) {
+        if (n != 0)
+            non_empty.push_back(n);
+    }
+    assert((non_empty == std::vector<std::size_t>{2, 1, 3}));
+    assert(result.all_contiguous);
+    assert(result.pushed == 0);
+}
+
+void test_concat_segments() {
+    std::vector<int> const a = {1, 2, 3};
+    std::array<int, 2> const b = {4, 5};
+    auto const result =
+        xviews::concat(a, b) | xranges::to<recording_container<int>>();
+    assert((result.elements() == std::vector<int>{1, 2, 3, 4, 5}));
+    assert((result.reserved == std::vector<std::size_t>{5}));
+    assert((result.appended == std::vector<std::size_t>{3, 2}));
+    assert(result.all_contiguous);
+    assert(result.pushed == 0);
+}
+
+// Without sized parts there is nothing to reserve, the result is the same.
+void test_unsized_parts() {
+    std::vector<std::forward_list<int>> const lists = {{1, 2}, {}, {3}};
+    auto const result =
+        lists | xviews::join | xranges::to<recording_container<int>>();
+    assert((result.elements() == std::vector<int>{1, 2, 3}));
+
+    auto const vector = lists | xviews::join | xranges::to<std::vector>();
+    assert((vector == std::vector<int>{1, 2, 3}));
+}
+
+// Materialising into a vector allocates its buffer exactly once.
+void test_single_allocation() {
+    std::vector<std::vector<int>> rows(100);
+    std::size_t total = 0;
+    for (std::size_t i = 0; i != rows.size(); ++i) {
+        rows[i].assign(i % 7, static_cast<int>(i));
+        total += rows[i].size();
+    }
+    std::vector<int> const a(1000, 1);
+    std::vector<int> const b(17, 2);
+    std::vector<std::string> const words = {"short", "words", "fit", "sso"};
+    std::vector<std::vector<std::string>> const sentences(10, words);
+
+    {
+        xtests::allocation_scope scope;
+        auto const result = rows | xviews::join | xranges::to<std::vector>();
+        assert(scope.allocations() == 1);
+        assert(result.size() == total);
+        assert(result.capacity() == total);
+    }
+    {
+        xtests::allocation_scope scope;
+        auto const result = xviews::concat(a, b) | xranges::to<std::vector>();
+        assert(scope.allocations() == 1);
+        assert(result.size() == 1017);
+        assert(result.capacity() == 1017);
+        assert(result[999] == 1 && result[1000] == 2);
+    }
+    {
+        xtests::allocation_scope scope;
+        auto const result =
+            sentences | xviews::join | xranges::to<std::vector>();
+        assert(scope.allocations() == 1);
+        assert(result.size() == 40);
+        assert(result[37] == "words");
+        assert(result[38] == "fit");
+    }
+}
+
+int main(int, char**) {
+    test_join_segments();
+    test_concat_segments();
+    test_unsized_parts();
+    test_single_allocation();
+
+    return 0;
+}
+#else
+int main() {
+    return 0;
+}
+#endif
@@ -0,0 +1,113 @@
+// Copyright 2025 Bryan Wong
+
+// Dot product and SAXPY loops over zip and zip_transform of contiguous
+// vectors, against std::views::zip and hand written index loops. With an
+// index based iterator the zip loops should vectorise like the hand written
+// ones.
+
+#include "rxx/algorithm.h"
+#include "rxx/ranges.h"
+
+#include "../benchmark.h"
+
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+namespace xtests = __RXX tests;
+
+constexpr std::size_t count = 1 << 16;
+
+void bench_dot(xtests::benchmark_suite& suite, std::vector<float> const& x,
+    std::vector<float> const& y) {
+    suite.run("dot", "hand_written", count, [&] {
+        float total = 0;
+        for (std::size_t i = 0; i != x.size(); ++i)
+            total += x[i] * y[i];
+        xtests::do_not_optimize(total);
+    });
+    suite.compare("dot/zip", count,
+        [&] {
+            float total = 0;
+            for (auto [a, b] : xviews::zip(x, y))
+                total += a * b;
+            xtests::do_not_optimize(total);
+        },
+        [&] {
+            float total = 0;
+            for (auto [a, b] : std::views::zip(x, y))
+                total += a * b;
+            xtests::do_not_optimize(total);
+        });
+    suite.compare("dot/zip_transform", count,
+        [&] {
+            float total = 0;
+            for (float product :
+                xviews::zip_transform(std::multiplies(), x, y))
+                total += product;
+            xtests::do_not_optimize(total);
+        },
+        [&] {
+            float total = 0;
+            for (float product :
+                std::views::zip_transform(std::multiplies(), x, y))
+                total += product;
+            xtests::do_not_optimize(total);
+        });
+}
+
+// Writes alpha * x + y to a separate output, so the values stay the same
+// from one iteration to the next.
+void bench_saxpy(xtests::benchmark_suite& suite, std::vector<float> const& x,
+    std::vector<float> const& y) {
+    float const alpha = 1.0001f;
+    std::vector<float> out(count);
+    suite.run("saxpy", "hand_written", count, [&] {
+        for (std::size_t i = 0; i != x.size(); ++i)
+            out[i] = alpha * x[i] + y[i];
+        xtests::do_not_optimize(out.data());
+    });
+    suite.compare("saxpy/zip", count,
+        [&] {
+            for (auto&& [a, b, c] : xviews::zip(x, y, out))
+                c = alpha * a + b;
+            xtests::do_not_optimize(out.data());
+        },
+        [&] {
+            for (auto&& [a, b, c] : std::views::zip(x, y, out))
+                c = alpha * a + b;
+            xtests::do_not_optimize(out.data());
+        });
+    suite.compare("saxpy/zip_transform", count,
+        [&] {
+            auto const result = xranges::copy(
+                xviews::zip_transform(
+                    [alpha](float a, float b) { return alpha * a + b; }, x, y),
+                out.begin());
+            xtests::do_not_optimize(result.out);
+        },
+        [&] {
+            auto const result = std::ranges::copy(
+                std::views::zip_transform(
+                    [alpha](float a, float b) { return alpha * a + b; }, x, y),
+                out.begin());
+            xtests::do_not_optimize(result.out);
+        });
+}
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    std::vector<float> x(count);
+    std::vector<float> y(count);
+    for (std::size_t i = 0; i != count; ++i) {
+        x[i] = static_cast<float>(i % 97) * 0.25f;
+        y[i] = static_cast<float>(i % 13);
+    }
+
+    bench_dot(suite, x, y);
+    bench_saxpy(suite, x, y);
+}
@@ -0,0 +1,131 @@
+// Copyright 2025 Bryan Wong
+
+// When every base of zip_view or zip_transform_view is random access and
+// sized, the iterator is a single index into the bases and the end check is
+// one comparison against the smallest size: the base iterators are never
+// compared while iterating. Bases of different lengths stop at the shortest
+// whatever the layout.
+
+#include "../../llvm/test_iterators.h"
+#include "rxx/ranges.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace xranges = __RXX ranges;
+namespace xviews = __RXX views;
+
+constexpr bool test_lengths() {
+    int a[] = {1, 2, 3, 4, 5};
+    std::array<int, 3> b = {10, 20, 30};
+    std::vector<int> c = {100, 200, 300, 400};
+
+    auto zipped = xviews::zip(a, b, c);
+    static_assert(xranges::random_access_range<decltype(zipped)>);
+    static_assert(xranges::common_range<decltype(zipped)>);
+    assert(xranges::size(zipped) == 3);
+    int total = 0;
+    for (auto [x, y, z] : zipped)
+        total += x + y + z;
+    assert(total == 6 + 60 + 600);
+
+    // Random access through the index.
+    auto it = zipped.begin();
+    auto [a2, b2, c2] = it[2];
+    assert(a2 == 3 && b2 == 30 && c2 == 300);
+    it += 2;
+    assert(zipped.end() - it == 1);
+    assert(it - zipped.begin() == 2);
+    assert(zipped.begin() < it);
+    --it;
+    auto [a1, b1, c1] = *it;
+    assert(a1 == 2 && b1 == 20 && c1 == 200);
+
+    // Writes go to the bases.
+    for (auto&& [x, y] : xviews::zip(a, b))
+        x = y;
+    assert(a[0] == 10 && a[2] == 30 && a[3] == 4);
+
+    auto sums = xviews::zip_transform(std::plus(), b, c);
+    static_assert(xranges::random_access_range<decltype(sums)>);
+    assert(xranges::size(sums) == 3);
+    assert(sums[1] == 220);
+    assert(*(sums.end() - 1) == 330);
+
+    // An empty base makes an empty zip.
+    std::array<int, 0> empty = {};
+    assert(xranges::empty(xviews::zip(a, empty, c)));
+    return true;
+}
+
+#if RXX_SUPPORTS_INDEXED_ZIP
+template <typename It>
+constexpr auto counted(int* first, int* last, IteratorOpCounts& ops) {
+    using counting_it = operation_counting_iterator<It>;
+    return xranges::subrange(counting_it(It(first), &ops),
+        sized_sentinel<counting_it>(counting_it(It(last))));
+}
+
+// Iterating compares no base iterator: the end check is on the index.
+template <typename It>
+constexpr void test_no_base_comparisons() {
+    int a[] = {1, 2, 3, 4, 5, 6};
+    int b[] = {6, 5, 4, 3};
+
+    IteratorOpCounts a_ops;
+    IteratorOpCounts b_ops;
+    auto zipped = xviews::zip(
+        counted<It>(a, a + 6, a_ops), counted<It>(b, b + 4, b_ops));
+    assert(xranges::size(zipped) == 4);
+    int total = 0;
+    for (auto [x, y] : zipped)
+        total += x * y;
+    assert(total == 6 + 10 + 12 + 12);
+    assert(a_ops.equal_cmps == 0);
+    assert(b_ops.equal_cmps == 0);
+
+    a_ops = {};
+    b_ops = {};
+    total = 0;
+    for (int product : xviews::zip_transform(std::multiplies(),
+             counted<It>(a, a + 6, a_ops), counted<It>(b, b + 4, b_ops)))
+        total += product;
+    assert(total == 40);
+    assert(a_ops.equal_cmps == 0);
+    assert(b_ops.equal_cmps == 0);
+}
+
+constexpr bool test_comparisons() {
+    test_no_base_comparisons<random_access_iterator<int*>>();
+    test_no_base_comparisons<contiguous_iterator<int*>>();
+    return true;
+}
+#endif
+
+// Bases that are not all random access and sized keep the general layout.
+void test_fallback() {
+    int a[] = {1, 2, 3};
+    using forward_range = xranges::subrange<forward_iterator<int*>>;
+    forward_range forward(
+        forward_iterator<int*>(a), forward_iterator<int*>(a + 3));
+    std::vector<int> b = {4, 5};
+    int total = 0;
+    for (auto [x, y] : xviews::zip(forward, b))
+        total += x * y;
+    assert(total == 4 + 10);
+}
+
+int main(int, char**) {
+    test_lengths();
+    static_assert(test_lengths());
+#if RXX_SUPPORTS_INDEXED_ZIP
+    test_comparisons();
+    static_assert(test_comparisons());
+#endif
+    test_fallback();
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+// Copyright 2025 Bryan Wong
+
+// template <class T> struct is_trivially_relocatable;
+// template <class T> constexpr bool is_trivially_relocatable_v;
+//
+// True when moving an object to new storage and destroying the original can
+// be done by copying its bytes. Trivially copyable types are relocatable,
+// other types can opt in by specializing the class template. The answer for
+// a cv-qualified type or an array is that of its element type.
+
+#include "rxx/config.h"
+
+#if RXX_SUPPORTS_TRIVIALLY_RELOCATABLE
+#  include "rxx/type_traits/is_trivially_relocatable.h"
+
+#  include <type_traits>
+#  include <utility>
+
+template <class T>
+constexpr bool relocatable = __RXX is_trivially_relocatable_v<T>;
+
+struct pod {
+    int i;
+    char c;
+};
+
+struct non_trivial_dtor {
+    ~non_trivial_dtor() {}
+};
+
+struct non_trivial_copy {
+    non_trivial_copy(non_trivial_copy const&) {}
+};
+
+// Owns a heap block through a pointer, so relocating by copying bytes is
+// correct even though copies and destruction are not trivial.
+struct owning_handle {
+    owning_handle() = default;
+    owning_handle(owning_handle&& other) noexcept : ptr(other.ptr) {
+        other.ptr = nullptr;
+    }
+    owning_handle& operator=(owning_handle&& other) noexcept {
+        std::swap(ptr, other.ptr);
+        return *this;
+    }
+    ~owning_handle() { delete ptr; }
+
+    int* ptr = nullptr;
+};
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+template <>
+struct is_trivially_relocatable<owning_handle> : std::true_type {};
+RXX_DEFAULT_NAMESPACE_END
+
+static_assert(relocatable<int>);
+static_assert(relocatable<double>);
+static_assert(relocatable<int*>);
+static_assert(relocatable<pod>);
+static_assert(relocatable<pod const>);
+static_assert(relocatable<pod[4]>);
+static_assert(relocatable<pod[2][3]>);
+
+static_assert(!relocatable<non_trivial_dtor>);
+static_assert(!relocatable<non_trivial_copy>);
+static_assert(!relocatable<non_trivial_copy[4]>);
+
+static_assert(relocatable<owning_handle>);
+static_assert(relocatable<owning_handle const>);
+static_assert(relocatable<owning_handle volatile>);
+static_assert(relocatable<owning_handle[8]>);
+static_assert(__RXX is_trivially_relocatable<owning_handle>::value);
+
+static_assert(std::is_base_of_v<std::true_type,
+    __RXX is_trivially_relocatable<pod>>);
+static_assert(std::is_base_of_v<std::false_type,
+    __RXX is_trivially_relocatable<non_trivial_dtor>>);
+#endif
@@ -0,0 +1,73 @@
+// Copyright 2025 Bryan Wong
+
+// Visitation must never touch the heap.
+
+#include "../count_new.h"
+#include "rxx/variant.h"
+
+#include <cassert>
+
+namespace xtests = __RXX tests;
+
+struct sum {
+    long operator()(int value) const { return value; }
+    long operator()(long value) const { return value * 10; }
+    long operator()(double value) const { return static_cast<long>(value); }
+};
+
+struct difference {
+    template <typename T, typename U>
+    long operator()(T left, U right) const {
+        return sum{}(left) - sum{}(right);
+    }
+};
+
+void test_unary() {
+    __RXX variant<int, long, double> values[] = {1, 2L, 3.0, 4, 5L};
+
+    xtests::assert_no_allocations([&] {
+        long total = 0;
+        for (auto const& value : values)
+            total += __RXX visit(sum{}, value);
+        assert(total == 1 + 20 + 3 + 4 + 50);
+    });
+
+    xtests::assert_no_allocations([&] {
+        long total = 0;
+        for (auto& value : values) {
+            total += __RXX visit<long>(
+                [](auto& alternative) { return ++alternative, 1L; }, value);
+        }
+        assert(total == 5);
+        assert(__RXX get<int>(values[0]) == 2);
+    });
+}
+
+void test_binary() {
+    __RXX variant<int, long, double> left = 4L;
+    __RXX variant<int, long, double> right = 3;
+
+    xtests::assert_no_allocations([&] {
+        assert(__RXX visit(difference{}, left, right) == 37);
+        left = 2.0;
+        assert(__RXX visit(difference{}, left, right) == -1);
+        right.emplace<long>(1);
+        assert(__RXX visit(difference{}, right, left) == 8);
+    });
+}
+
+void test_member() {
+    __RXX variant<int, long, double> value = 7;
+
+    xtests::assert_no_allocations([&] {
+        assert(value.visit(sum{}) == 7);
+        value = 8L;
+        assert(value.visit<long>(sum{}) == 80);
+    });
+}
+
+int main() {
+    test_unary();
+    test_binary();
+    test_member();
+}
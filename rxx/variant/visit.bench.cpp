@@ -0,0 +1,93 @@
+// Copyright 2025 Bryan Wong
+
+#include "rxx/variant.h"
+
+#include "../benchmark.h"
+
+#include <cstddef>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace xtests = __RXX tests;
+
+struct accumulate {
+    long long operator()(int value) const { return value; }
+    long long operator()(long long value) const { return value * 2; }
+    long long operator()(double value) const {
+        return static_cast<long long>(value);
+    }
+    long long operator()(std::string const& value) const {
+        return static_cast<long long>(value.size());
+    }
+};
+
+struct combine {
+    template <typename T, typename U>
+    long long operator()(T const& left, U const& right) const {
+        return accumulate{}(left) - accumulate{}(right);
+    }
+};
+
+template <template <typename...> class Variant>
+std::vector<Variant<int, long long, double, std::string>> make_data(
+    std::size_t count) {
+    std::vector<Variant<int, long long, double, std::string>> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i != count; ++i) {
+        switch (i % 4) {
+        case 0:
+            result.emplace_back(static_cast<int>(i));
+            break;
+        case 1:
+            result.emplace_back(static_cast<long long>(i));
+            break;
+        case 2:
+            result.emplace_back(static_cast<double>(i));
+            break;
+        default:
+            result.emplace_back(std::string(i % 13, 'x'));
+            break;
+        }
+    }
+    return result;
+}
+
+constexpr std::size_t count = 1 << 16;
+
+int main() {
+    xtests::benchmark_suite suite(__FILE__);
+
+    auto const rxx_data = make_data<__RXX variant>(count);
+    auto const std_data = make_data<std::variant>(count);
+
+    suite.compare(
+        "visit/unary/4 alternatives", count,
+        [&] {
+            long long total = 0;
+            for (auto const& value : rxx_data)
+                total += __RXX visit(accumulate{}, value);
+            xtests::do_not_optimize(total);
+        },
+        [&] {
+            long long total = 0;
+            for (auto const& value : std_data)
+                total += std::visit(accumulate{}, value);
+            xtests::do_not_optimize(total);
+        });
+
+    suite.compare(
+        "visit/binary/4x4 alternatives", count - 1,
+        [&] {
+            long long total = 0;
+            for (std::size_t i = 1; i != count; ++i)
+                total += __RXX visit(combine{}, rxx_data[i - 1], rxx_data[i]);
+            xtests::do_not_optimize(total);
+        },
+        [&] {
+            long long total = 0;
+            for (std::size_t i = 1; i != count; ++i)
+                total += std::visit(combine{}, std_data[i - 1], std_data[i]);
+            xtests::do_not_optimize(total);
+        });
+}
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+# Copyright 2025 Bryan Wong
+
+"""Compares two benchmark reports produced by `make bench`.
+
+Each report is a JSON Lines file with one measurement per line. Measurements
+are matched on (source, group, implementation); a regression is reported when
+the median time of an `rxx` measurement grew by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    results = {}
+    with open(path, encoding="utf-8") as report:
+        for line in report:
+            line = line.strip()
+            if not line:
+                continue
+            entry = json.loads(line)
+            key = (entry["source"], entry["group"], entry["implementation"])
+            results[key] = entry
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="relative slowdown treated as a regression")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+    regressions = 0
+
+    for key in sorted(current):
+        source, group, implementation = key
+        entry = current[key]
+        previous = baseline.get(key)
+        if previous is None:
+            print(f"NEW        {source}: {group} [{implementation}]")
+            continue
+
+        ratio = entry["median_ns"] / previous["median_ns"]
+        status = "OK"
+        if implementation == "rxx" and ratio > 1.0 + args.threshold:
+            status = "REGRESSED"
+            regressions += 1
+        elif ratio < 1.0 - args.threshold:
+            status = "IMPROVED"
+        print(f"{status:<10} {source}: {group} [{implementation}] "
+              f"{previous['median_ns']:.1f} -> {entry['median_ns']:.1f} ns "
+              f"({ratio:.3f}x)")
+
+    for key in sorted(set(baseline) - set(current)):
+        source, group, implementation = key
+        print(f"MISSING    {source}: {group} [{implementation}]")
+
+    if regressions:
+        print(f"{regressions} benchmark(s) regressed by more than "
+              f"{args.threshold:.0%}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
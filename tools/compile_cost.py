@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+# Copyright 2025 Bryan Wong
+
+"""Measures and reports the compile-time cost of the test suite.
+
+`measure` compiles one translation unit and records its cost as JSON:
+  - wall time of the compiler invocation and its frontend time
+  - template instantiation time and, with clang, instantiation counts
+  - peak resident memory of the compiler process
+
+Clang results come from `-ftime-trace`, GCC results from `-ftime-report`.
+GCC does not report instantiation counts, they are recorded as null.
+
+`report` merges the per translation unit results, prints the worst
+offenders and compares them against a stored baseline.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def compiler_kind(command):
+    try:
+        version = subprocess.run([command, "--version"], capture_output=True,
+                                 text=True, check=False).stdout
+    except OSError:
+        return "unknown"
+    if "clang" in version:
+        return "clang"
+    if "Free Software Foundation" in version or "GCC" in version:
+        return "gcc"
+    return "unknown"
+
+
+def run_with_rusage(command):
+    """Runs command, returns (exit status, stderr, peak RSS in KiB)."""
+    with tempfile.TemporaryFile() as err:
+        process = subprocess.Popen(command, stderr=err)
+        _, status, usage = os.wait4(process.pid, 0)
+        process.returncode = os.waitstatus_to_exitcode(status)
+        err.seek(0)
+        stderr = err.read().decode(errors="replace")
+    peak = usage.ru_maxrss
+    if sys.platform == "darwin":
+        peak //= 1024
+    return process.returncode, stderr, peak
+
+
+GCC_TIMEVAR = re.compile(
+    r"^\s*(?P<name>[^:]+?)\s*:\s*[\d.]+\s*\(\s*\d+%\)\s*[\d.]+\s*\(\s*\d+%\)"
+    r"\s*(?P<wall>[\d.]+)")
+
+
+def parse_gcc_report(stderr):
+    phases = {}
+    for line in stderr.splitlines():
+        match = GCC_TIMEVAR.match(line)
+        if match:
+            phases[match["name"]] = float(match["wall"]) * 1000.0
+    frontend = phases.get("phase parsing", 0.0) + phases.get(
+        "phase lang. deferred", 0.0)
+    return {
+        "frontend_ms": frontend,
+        "instantiation_ms": phases.get("template instantiation"),
+        "class_instantiations": None,
+        "function_instantiations": None,
+    }
+
+
+def parse_clang_trace(path):
+    with open(path, encoding="utf-8") as trace:
+        events = json.load(trace)["traceEvents"]
+    totals = {}
+    for event in events:
+        name = event.get("name", "")
+        if name.startswith("Total "):
+            totals[name[len("Total "):]] = event
+    def duration(name):
+        event = totals.get(name)
+        return event["dur"] / 1000.0 if event else 0.0
+    def count(name):
+        event = totals.get(name)
+        return event.get("args", {}).get("count", 0) if event else 0
+    return {
+        "frontend_ms": duration("Frontend"),
+        "instantiation_ms":
+            duration("InstantiateClass") + duration("InstantiateFunction"),
+        "class_instantiations": count("InstantiateClass"),
+        "function_instantiations": count("InstantiateFunction"),
+    }
+
+
+def measure(args):
+    command = list(args.command)
+    if command and command[0] == "--":
+        command = command[1:]
+    kind = compiler_kind(command[0])
+
+    with tempfile.TemporaryDirectory() as scratch:
+        obj = os.path.join(scratch, "tu.o")
+        command += ["-o", obj]
+        if kind == "clang":
+            command += ["-ftime-trace"]
+        elif kind == "gcc":
+            command += ["-ftime-report"]
+
+        start = time.perf_counter()
+        status, stderr, peak = run_with_rusage(command)
+        wall = (time.perf_counter() - start) * 1000.0
+        if status != 0:
+            sys.stderr.write(stderr)
+            return status
+
+        if kind == "clang":
+            stats = parse_clang_trace(os.path.join(scratch, "tu.json"))
+        elif kind == "gcc":
+            stats = parse_gcc_report(stderr)
+        else:
+            stats = {
+                "frontend_ms": None,
+                "instantiation_ms": None,
+                "class_instantiations": None,
+                "function_instantiations": None,
+            }
+
+    result = {
+        "source": args.source,
+        "compiler": kind,
+        "wall_ms": round(wall, 3),
+        "peak_rss_kb": peak,
+    }
+    result.update({key: round(value, 3) if isinstance(value, float) else value
+                   for key, value in stats.items()})
+
+    os.makedirs(os.path.dirname(args.output) or ".", exist_ok=True)
+    with open(args.output, "w", encoding="utf-8") as output:
+        json.dump(result, output)
+        output.write("\n")
+    return 0
+
+
+METRICS = {
+    "frontend_ms": "frontend time (ms)",
+    "instantiations": "template instantiations",
+    "peak_rss_kb": "peak memory (KiB)",
+}
+
+
+def metric(entry, name):
+    if name == "instantiations":
+        classes = entry.get("class_instantiations")
+        functions = entry.get("function_instantiations")
+        if classes is None or functions is None:
+            return None
+        return classes + functions
+    return entry.get(name)
+
+
+def load_results(paths):
+    results = {}
+    for path in paths:
+        with open(path, encoding="utf-8") as result:
+            entry = json.load(result)
+        results[entry["source"]] = entry
+    return results
+
+
+def report(args):
+    results = load_results(args.results)
+    with open(args.output, "w", encoding="utf-8") as output:
+        json.dump({"results": [results[key] for key in sorted(results)]},
+                  output, indent=1)
+        output.write("\n")
+
+    for name, title in METRICS.items():
+        ranked = sorted(((metric(entry, name), source)
+                         for source, entry in results.items()
+                         if metric(entry, name) is not None), reverse=True)
+        if not ranked:
+            continue
+        print(f"Worst {min(args.top, len(ranked))} by {title}:")
+        for value, source in ranked[:args.top]:
+            print(f"  {value:>12.0f}  {source}")
+
+    if not args.baseline:
+        return 0
+    if not os.path.exists(args.baseline):
+        print(f"No baseline at {args.baseline}, skipping comparison")
+        return 0
+
+    with open(args.baseline, encoding="utf-8") as baseline_file:
+        baseline = {entry["source"]: entry
+                    for entry in json.load(baseline_file)["results"]}
+
+    regressions = []
+    for source, entry in sorted(results.items()):
+        previous = baseline.get(source)
+        if previous is None:
+            continue
+        for name, title in METRICS.items():
+            old, new = metric(previous, name), metric(entry, name)
+            if not old or new is None:
+                continue
+            # Ignore noise on cheap translation units.
+            if name == "frontend_ms" and new - old < args.min_delta_ms:
+                continue
+            if new > old * (1.0 + args.threshold):
+                regressions.append((source, title, old, new))
+
+    for source, title, old, new in regressions:
+        print(f"REGRESSED  {source}: {title} {old:.0f} -> {new:.0f} "
+              f"({new / old:.2f}x)")
+    if regressions:
+        print(f"{len(regressions)} compile cost regression(s) above "
+              f"{args.threshold:.0%}", file=sys.stderr)
+        return 1
+    print(f"No compile cost regressions against {args.baseline}")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="mode", required=True)
+
+    measure_parser = commands.add_parser("measure")
+    measure_parser.add_argument("--source", required=True)
+    measure_parser.add_argument("--output", required=True)
+    measure_parser.add_argument("command", nargs=argparse.REMAINDER)
+
+    report_parser = commands.add_parser("report")
+    report_parser.add_argument("--output", required=True)
+    report_parser.add_argument("--baseline")
+    report_parser.add_argument("--threshold", type=float, default=0.15)
+    report_parser.add_argument("--min-delta-ms", type=float, default=50.0)
+    report_parser.add_argument("--top", type=int, default=15)
+    report_parser.add_argument("results", nargs="+")
+
+    args = parser.parse_args()
+    return measure(args) if args.mode == "measure" else report(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+# Copyright 2025 Bryan Wong
+
+"""Audits the dependencies of the per-view rxx headers.
+
+For every header matching the pattern (by default `rxx/ranges/*.h`) the audit
+  1. compiles a translation unit containing only that header, proving that it
+     is self-contained;
+  2. records its transitive rxx and standard library includes and fails if an
+     umbrella header (e.g. `rxx/ranges.h`) is pulled in;
+  3. recompiles it once per direct `#include "rxx/..."` with that line removed
+     and reports the includes the header still compiles without;
+  4. optionally compares the transitive include sets with a baseline so that
+     new dependencies are caught in review.
+
+Usage:
+  header_audit.py --rxx-src ../r20 [--baseline audit.json] -- c++ -std=c++23 ...
+"""
+
+import argparse
+import concurrent.futures
+import glob
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+UMBRELLA_HEADERS = {
+    "rxx/algorithm.h",
+    "rxx/functional.h",
+    "rxx/iterator.h",
+    "rxx/memory.h",
+    "rxx/optional.h",
+    "rxx/ranges.h",
+    "rxx/tuple.h",
+    "rxx/variant.h",
+}
+
+RXX_INCLUDE = re.compile(r'^\s*#\s*include\s*"(rxx/[^"]+)"')
+
+
+def compile_header(compiler, include_dirs, header):
+    """Compiles a TU including only `header`, returns (ok, stderr, deps)."""
+    with tempfile.TemporaryDirectory() as scratch:
+        source = os.path.join(scratch, "tu.cpp")
+        deps = os.path.join(scratch, "tu.d")
+        with open(source, "w", encoding="utf-8") as tu:
+            tu.write(f'#include "{header}"\n')
+        command = list(compiler)
+        command += [f"-I{path}" for path in include_dirs]
+        command += ["-fsyntax-only", "-MD", "-MF", deps, source]
+        process = subprocess.run(command, capture_output=True, text=True,
+                                 check=False)
+        if process.returncode != 0:
+            return False, process.stderr, []
+        with open(deps, encoding="utf-8") as dep_file:
+            contents = dep_file.read().replace("\\\n", " ")
+        files = contents.split(":", 1)[1].split()
+        return True, "", files[1:]
+
+
+def classify(files, rxx_src):
+    root = os.path.realpath(rxx_src) + os.sep
+    rxx, system = set(), set()
+    for path in files:
+        real = os.path.realpath(path)
+        if real.startswith(root):
+            rxx.add(os.path.relpath(real, root))
+        elif "." not in os.path.basename(path):
+            # Only the public standard headers, e.g. <vector>, are tracked;
+            # implementation details differ between standard libraries.
+            system.add(os.path.basename(path))
+    return sorted(rxx), sorted(system)
+
+
+def removable_includes(compiler, rxx_src, header):
+    """Returns the direct rxx includes `header` compiles without."""
+    path = os.path.join(rxx_src, header)
+    with open(path, encoding="utf-8") as source:
+        lines = source.readlines()
+
+    removable = []
+    for index, line in enumerate(lines):
+        match = RXX_INCLUDE.match(line)
+        if not match or match[1] == "rxx/config.h":
+            continue
+        with tempfile.TemporaryDirectory() as overlay:
+            target = os.path.join(overlay, header)
+            os.makedirs(os.path.dirname(target))
+            with open(target, "w", encoding="utf-8") as copy:
+                copy.writelines(lines[:index] + ["\n"] + lines[index + 1:])
+            ok, _, _ = compile_header(compiler, [overlay, rxx_src], header)
+        if ok:
+            removable.append(match[1])
+    return removable
+
+
+def audit(compiler, rxx_src, header, check_removable):
+    ok, stderr, files = compile_header(compiler, [rxx_src], header)
+    result = {"header": header, "self_contained": ok}
+    if not ok:
+        result["error"] = stderr.strip().splitlines()[:10]
+        return result
+    rxx, system = classify(files, rxx_src)
+    result["rxx_includes"] = rxx
+    result["std_includes"] = system
+    result["transitive_files"] = len(files)
+    result["umbrellas"] = sorted(set(rxx) & UMBRELLA_HEADERS)
+    if check_removable:
+        result["removable"] = removable_includes(compiler, rxx_src, header)
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--rxx-src", required=True)
+    parser.add_argument("--pattern", default="rxx/ranges/*.h")
+    parser.add_argument("--baseline")
+    parser.add_argument("--output")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count() or 1)
+    parser.add_argument("--no-removable", action="store_true",
+                        help="skip the (slow) removable include check")
+    parser.add_argument("--strict", action="store_true",
+                        help="treat removable includes as failures")
+    parser.add_argument("compiler", nargs=argparse.REMAINDER)
+    args = parser.parse_args()
+
+    compiler = args.compiler[1:] if args.compiler[:1] == ["--"] \
+        else args.compiler
+    if not compiler or shutil.which(compiler[0]) is None:
+        parser.error("a compiler command is required after --")
+
+    headers = sorted(os.path.relpath(path, args.rxx_src) for path in
+                     glob.glob(os.path.join(args.rxx_src, args.pattern)))
+    with concurrent.futures.ThreadPoolExecutor(args.jobs) as pool:
+        results = list(pool.map(
+            lambda header: audit(compiler, args.rxx_src, header,
+                                 not args.no_removable), headers))
+
+    baseline = {}
+    if args.baseline and os.path.exists(args.baseline):
+        with open(args.baseline, encoding="utf-8") as baseline_file:
+            baseline = {entry["header"]: entry
+                        for entry in json.load(baseline_file)["results"]}
+
+    failures = 0
+    for result in results:
+        header = result["header"]
+        if not result["self_contained"]:
+            failures += 1
+            print(f"NOT SELF-CONTAINED  {header}")
+            for line in result["error"]:
+                print(f"    {line}")
+            continue
+        for umbrella in result["umbrellas"]:
+            failures += 1
+            print(f"UMBRELLA            {header} includes {umbrella}")
+        for include in result.get("removable", []):
+            failures += args.strict
+            print(f"REMOVABLE           {header}: {include}")
+        previous = baseline.get(header)
+        if previous and previous.get("self_contained"):
+            for kind in ("rxx_includes", "std_includes"):
+                for added in sorted(set(result[kind]) -
+                                    set(previous.get(kind, []))):
+                    failures += 1
+                    print(f"NEW DEPENDENCY      {header}: {added}")
+
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as output:
+            json.dump({"results": results}, output, indent=1)
+            output.write("\n")
+
+    print(f"Audited {len(results)} header(s), {failures} problem(s)")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
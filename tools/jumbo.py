@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+# Copyright 2025 Bryan Wong
+
+"""Generates unity (jumbo) translation units for the `*.pass.cpp` tests.
+
+All tests of one directory are merged into a single translation unit:
+  - every `#include` is hoisted to the top of the file, once, with relative
+    includes rewritten to absolute paths;
+  - each test body is wrapped in its own namespace and its `main` renamed to
+    `int jumbo_main`, with the `return 0` main implies made explicit; macros
+    it defines are undefined afterwards;
+  - `#line` directives attribute each body to its test file and the code
+    generated around it to the jumbo file;
+  - a generated `main` runs every test in a child process (where supported)
+    and reports each result on its own, like the `run` target does.
+
+Some tests cannot be merged safely, e.g. those that specialise templates of
+another namespace, replace `operator new`, define macros before including
+headers or include headers conditionally. `standalone` lists them so that they
+are still built and run as individual executables.
+"""
+
+import argparse
+import io
+import os
+import re
+import sys
+
+INCLUDE = re.compile(r'^\s*#\s*include\s*([<"])([^>"]+)[>"]')
+DEFINE = re.compile(r"^\s*#\s*define\s+(\w+)")
+CONDITIONAL_BEGIN = re.compile(r"^\s*#\s*if")
+CONDITIONAL_END = re.compile(r"^\s*#\s*endif")
+MAIN = re.compile(r"^(\s*)int(\s+)main(\s*\()")
+# A return statement at the outermost level of a function body.
+RETURN = re.compile(r"^ {4}return\b")
+
+NOT_MERGEABLE = [
+    # Specialisations must be declared in an enclosing namespace.
+    re.compile(r"template\s*<[^;{]*>\s*(inline\s+)?(constexpr\s+)?"
+               r"(bool|struct|class)\s+(::)?(std|rxx|__RXX|xranges|xviews)\b"),
+    re.compile(r"\b(struct|class)\s+(::)?std::"),
+    re.compile(r"\bnamespace\s+std\b"),
+    re.compile(r"_NAMESPACE_BEGIN\b"),
+    # Replacement allocation functions must be global.
+    re.compile(r"\boperator\s+(new|delete)\b"),
+]
+
+
+def mergeable(path, excluded):
+    if path in excluded:
+        return False
+    with open(path, encoding="utf-8") as source:
+        lines = source.read().splitlines()
+    text = "\n".join(lines)
+    if any(pattern.search(text) for pattern in NOT_MERGEABLE):
+        return False
+    if not any(MAIN.match(line) for line in lines):
+        return False
+
+    depth = 0
+    last_include = -1
+    first_define = None
+    for index, line in enumerate(lines):
+        if CONDITIONAL_BEGIN.match(line):
+            depth += 1
+        elif CONDITIONAL_END.match(line):
+            depth -= 1
+        elif INCLUDE.match(line):
+            if depth:
+                return False
+            last_include = index
+        elif DEFINE.match(line) and first_define is None:
+            first_define = index
+    return first_define is None or first_define > last_include
+
+
+def generate(paths, output, root):
+    includes = []
+    seen = set()
+    bodies = []
+
+    for index, path in enumerate(paths):
+        with open(path, encoding="utf-8") as source:
+            lines = source.read().splitlines()
+        body = []
+        macros = []
+        in_main = False
+        for line in lines:
+            match = INCLUDE.match(line)
+            if match:
+                kind, name = match.groups()
+                if kind == '"' and not name.startswith("rxx/"):
+                    local = os.path.join(os.path.dirname(path), name)
+                    if os.path.exists(local):
+                        name = os.path.realpath(local)
+                key = (kind, name)
+                if key not in seen:
+                    seen.add(key)
+                    includes.append(f'#include "{name}"' if kind == '"'
+                                    else f"#include <{name}>")
+                body.append("")
+                continue
+            define = DEFINE.match(line)
+            if define:
+                macros.append(define[1])
+            if MAIN.match(line):
+                in_main = True
+                line = MAIN.sub(r"\1int\2jumbo_main\3", line)
+            elif in_main and line.startswith("}"):
+                # Only main returns 0 when control reaches its end. The
+                # return shares the line of the brace to keep #line exact.
+                in_main = False
+                last = next((l for l in reversed(body) if l.strip()), "")
+                if not RETURN.match(last):
+                    line = "    return 0; " + line
+            body.append(line)
+        bodies.append((index, path, body, macros))
+
+    # Built in memory so that the line of each #line directive is known.
+    with io.StringIO() as tu:
+        tu.write("// Generated by tools/jumbo.py, do not edit.\n\n")
+        tu.write("\n".join(includes))
+        tu.write("\n\n#include <cstdio>\n#include <cstring>\n"
+                 "#include <type_traits>\n\n"
+                 "#if __has_include(<sys/wait.h>) && "
+                 "__has_include(<unistd.h>)\n"
+                 "#  include <sys/wait.h>\n#  include <unistd.h>\n"
+                 "#  define JUMBO_USE_FORK 1\n#endif\n")
+
+        for index, path, body, macros in bodies:
+            tu.write(f"\nnamespace jumbo_{index} {{\n")
+            tu.write(f'#line 1 "{path}"\n')
+            tu.write("\n".join(body))
+            tu.write("\n")
+            line = tu.getvalue().count("\n") + 2
+            tu.write(f'#line {line} "{output}"\n')
+            tu.write(f"}} // namespace jumbo_{index}\n")
+            for macro in sorted(set(macros)):
+                tu.write(f"#undef {macro}\n")
+
+        tu.write("""
+namespace {
+template <typename F>
+int jumbo_invoke(F* test, int argc, char** argv) {
+    if constexpr (std::is_invocable_v<F*, int, char**>)
+        return test(argc, argv);
+    else
+        return test();
+}
+
+struct jumbo_test {
+    char const* name;
+    int (*run)(int, char**);
+};
+
+jumbo_test const jumbo_tests[] = {
+""")
+        for index, path, _, _ in bodies:
+            name = os.path.relpath(path, root)[:-len(".cpp")]
+            tu.write(f'    {{"{name}", [](int argc, char** argv) {{\n'
+                     f"         return jumbo_invoke(&jumbo_{index}::jumbo_main, "
+                     f"argc, argv);\n     }}}},\n")
+        tu.write("""};
+
+int jumbo_run(jumbo_test const& test, int argc, char** argv) {
+#if JUMBO_USE_FORK
+    std::fflush(nullptr);
+    pid_t const pid = fork();
+    if (pid == 0)
+        _exit(test.run(argc, argv));
+    int status = 0;
+    if (pid < 0 || waitpid(pid, &status, 0) != pid)
+        return -1;
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+#else
+    return test.run(argc, argv);
+#endif
+}
+} // namespace
+
+// Runs every merged test, or only those named on the command line.
+int main(int argc, char** argv) {
+    int failures = 0;
+    for (auto const& test : jumbo_tests) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc; ++i)
+            selected = selected || std::strcmp(argv[i], test.name) == 0;
+        if (!selected)
+            continue;
+        if (jumbo_run(test, 1, argv) == 0) {
+            std::printf("\\033[0;34mTEST\\033[0m %s: \\033[0;32mSUCCESS\\033[0m\\n",
+                test.name);
+        } else {
+            std::printf("\\033[0;34mTEST\\033[0m %s: \\033[0;31mFAILED\\033[0m\\n",
+                test.name);
+            ++failures;
+        }
+        std::fflush(stdout);
+    }
+    return failures == 0 ? 0 : 1;
+}
+""")
+
+        with open(output, "w", encoding="utf-8") as file:
+            file.write(tu.getvalue())
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="mode", required=True)
+    for mode in ("standalone", "generate"):
+        command = commands.add_parser(mode)
+        command.add_argument("--exclude", action="append", default=[])
+        if mode == "generate":
+            command.add_argument("--output", required=True)
+            command.add_argument("--root", default=".",
+                                 help="test names are reported relative to it")
+        command.add_argument("tests", nargs="*")
+    args = parser.parse_args()
+
+    excluded = {os.path.abspath(path) for path in args.exclude}
+    tests = [os.path.abspath(path) for path in args.tests
+             if not path.endswith(".compile.pass.cpp")]
+
+    if args.mode == "standalone":
+        for path in tests:
+            if not mergeable(path, excluded):
+                print(path)
+        return 0
+
+    os.makedirs(os.path.dirname(args.output) or ".", exist_ok=True)
+    generate(sorted(path for path in tests if mergeable(path, excluded)),
+             args.output, args.root)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+# Copyright 2025 Bryan Wong
+
+"""Parallel, sharded runner for the `*.pass` test executables.
+
+`select` prints the tests belonging to a shard. Tests are assigned to shards
+by a stable hash of their path relative to the build directory, so every
+machine computes the same partition without coordination.
+
+`run` executes tests on a pool of workers and records the exit status, wall
+time and peak resident memory of every test binary. It writes a JSON report
+and, optionally, a JUnit XML report, and prints the slowest tests.
+
+Peak memory comes from wait4(). On Linux a forked child inherits the runner's
+resident set as its starting high-water mark, so the report also records that
+floor as `rss_floor_kb`; values at the floor mean "no more than the runner".
+"""
+
+import argparse
+import concurrent.futures
+import hashlib
+import json
+import os
+import resource
+import signal
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+import xml.etree.ElementTree as ElementTree
+
+BLUE = "\033[0;34m"
+GREEN = "\033[0;32m"
+RED = "\033[0;31m"
+RESET = "\033[0m"
+
+
+def parse_shard(text):
+    index, _, count = text.partition("/")
+    index, count = int(index), int(count or 1)
+    if count < 1 or not 0 <= index < count:
+        raise argparse.ArgumentTypeError(f"invalid shard '{text}'")
+    return index, count
+
+
+def in_shard(name, shard):
+    index, count = shard
+    digest = hashlib.sha1(name.encode("utf-8")).digest()
+    return int.from_bytes(digest[:8], "little") % count == index
+
+
+def run_one(build_dir, name, timeout):
+    path = os.path.join(build_dir, name)
+    with tempfile.TemporaryFile() as output:
+        start = time.perf_counter()
+        try:
+            process = subprocess.Popen([path], stdout=output,
+                                       stderr=subprocess.STDOUT,
+                                       start_new_session=True)
+        except OSError as error:
+            return {"name": name, "status": "error", "exit_code": None,
+                    "wall_ms": 0.0, "max_rss_kb": 0, "output": str(error)}
+
+        timed_out = threading.Event()
+
+        def kill():
+            timed_out.set()
+            try:
+                os.killpg(process.pid, signal.SIGKILL)
+            except ProcessLookupError:
+                pass
+
+        timer = threading.Timer(timeout, kill) if timeout else None
+        if timer:
+            timer.start()
+        _, status, usage = os.wait4(process.pid, 0)
+        wall = (time.perf_counter() - start) * 1000.0
+        if timer:
+            timer.cancel()
+
+        output.seek(0)
+        text = output.read().decode(errors="replace")
+
+    exit_code = os.waitstatus_to_exitcode(status)
+    peak = usage.ru_maxrss // 1024 if sys.platform == "darwin" \
+        else usage.ru_maxrss
+    if timed_out.is_set():
+        state = "timeout"
+    elif exit_code == 0:
+        state = "success"
+    else:
+        state = "failed"
+    return {"name": name, "status": state, "exit_code": exit_code,
+            "wall_ms": round(wall, 3), "max_rss_kb": peak,
+            "output": text[-4096:]}
+
+
+def write_junit(path, results, shard):
+    failures = sum(result["status"] != "success" for result in results)
+    suite = ElementTree.Element("testsuite", {
+        "name": f"r20-tests shard {shard[0]}/{shard[1]}",
+        "tests": str(len(results)),
+        "failures": str(failures),
+        "time": f"{sum(result['wall_ms'] for result in results) / 1000.0:.3f}",
+    })
+    for result in results:
+        directory, _, test = result["name"].rpartition("/")
+        case = ElementTree.SubElement(suite, "testcase", {
+            "classname": directory.replace("/", "."),
+            "name": test,
+            "time": f"{result['wall_ms'] / 1000.0:.3f}",
+        })
+        properties = ElementTree.SubElement(case, "properties")
+        ElementTree.SubElement(properties, "property", {
+            "name": "max_rss_kb", "value": str(result["max_rss_kb"])})
+        if result["status"] != "success":
+            failure = ElementTree.SubElement(case, "failure", {
+                "message": f"{result['status']} "
+                           f"(exit code {result['exit_code']})"})
+            failure.text = result["output"]
+    ElementTree.ElementTree(suite).write(path, encoding="utf-8",
+                                         xml_declaration=True)
+
+
+def run(args):
+    names = [name for name in args.tests if in_shard(name, args.shard)]
+    rss_floor = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    if sys.platform == "darwin":
+        rss_floor //= 1024
+    results = []
+    with concurrent.futures.ThreadPoolExecutor(args.jobs) as pool:
+        futures = [pool.submit(run_one, args.build_dir, name, args.timeout)
+                   for name in names]
+        for future in concurrent.futures.as_completed(futures):
+            result = future.result()
+            results.append(result)
+            if result["status"] == "success":
+                print(f"{BLUE}TEST{RESET} {result['name']}: "
+                      f"{GREEN}SUCCESS{RESET}", flush=True)
+            else:
+                print(f"{BLUE}TEST{RESET} {result['name']}: "
+                      f"{RED}{result['status'].upper()}{RESET}", flush=True)
+                sys.stdout.write(result["output"])
+
+    results.sort(key=lambda result: result["name"])
+    failed = [result for result in results if result["status"] != "success"]
+
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as report:
+            json.dump({
+                "shard": f"{args.shard[0]}/{args.shard[1]}",
+                "jobs": args.jobs,
+                "rss_floor_kb": rss_floor,
+                "total": len(results),
+                "failed": len(failed),
+                "tests": results,
+            }, report, indent=1)
+            report.write("\n")
+    if args.junit:
+        write_junit(args.junit, results, args.shard)
+
+    if args.slowest:
+        print(f"Slowest {min(args.slowest, len(results))} test(s):")
+        for result in sorted(results, key=lambda result: result["wall_ms"],
+                             reverse=True)[:args.slowest]:
+            print(f"  {result['wall_ms']:>10.1f} ms "
+                  f"{result['max_rss_kb']:>9} KiB  {result['name']}")
+
+    print(f"{len(results) - len(failed)}/{len(results)} test(s) passed")
+    return 1 if failed else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="mode", required=True)
+
+    select_parser = commands.add_parser("select")
+    select_parser.add_argument("--shard", type=parse_shard, default=(0, 1))
+    select_parser.add_argument("tests", nargs="*")
+
+    run_parser = commands.add_parser("run")
+    run_parser.add_argument("--build-dir", required=True)
+    run_parser.add_argument("--shard", type=parse_shard, default=(0, 1))
+    run_parser.add_argument("--jobs", type=int, default=os.cpu_count() or 1)
+    run_parser.add_argument("--timeout", type=float, default=300.0,
+                            help="per test timeout in seconds, 0 to disable")
+    run_parser.add_argument("--json")
+    run_parser.add_argument("--junit")
+    run_parser.add_argument("--slowest", type=int, default=10)
+    run_parser.add_argument("tests", nargs="*")
+
+    args = parser.parse_args()
+    if args.mode == "select":
+        for name in args.tests:
+            if in_shard(name, args.shard):
+                print(name)
+        return 0
+    return run(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())